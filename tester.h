@@ -3,6 +3,70 @@
 #include <iostream>
 #include <any>
 #include <functional>
+#include <tuple>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <iomanip>
+#include <ranges>
+#include <type_traits>
+#include <limits>
+#include <fstream>
+#include <thread>
+#include <atomic>
+#include <memory_resource>
+#include <optional>
+#include <memory>
+#include <map>
+#include <set>
+#include <mutex>
+#include <condition_variable>
+#include <stdexcept>
+#include <deque>
+#include <cstring>
+#include <cstdlib>
+#include <new>
+#include <cerrno>
+#include <cstdio>
+#include <iterator>
+#include <typeindex>
+#include <exception>
+#include <cmath>
+#include <bit>
+#include <charconv>
+#include <string_view>
+#include <filesystem>
+#include <csignal>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <x86intrin.h>
+#include <cpuid.h>
+#endif
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#include <poll.h>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+#if defined(__linux__)
+#include <sched.h>
+#endif
+#if defined(__GLIBC__) || defined(__APPLE__)
+#include <execinfo.h>
+#endif
+#if defined(__GNUG__)
+#include <cxxabi.h>
+#endif
 
 /* Simple C++ Tester Library
  * This code is available for use according the MIT license.
@@ -54,6 +118,314 @@ namespace TesterLib {
         return newVec;
     }
 
+    /**
+     * @brief Appends text to out as a JSON string, with quotes
+     * @param out The buffer to append to
+     * @param text The text to quote and escape
+     */
+    inline void appendJsonString(std::string &out, const std::string &text) {
+        out += '"';
+        for(char c : text) {
+            if(c == '"' || c == '\\') {
+                out += '\\';
+                out += c;
+            }
+            else if(static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned char>(c));
+                out += escaped;
+            }
+            else {
+                out += c;
+            }
+        }
+        out += '"';
+    }
+
+    /**
+     * @brief Turns a value into text for a Result message
+     * @tparam T The type of the value
+     * @param value The value
+     * @return What operator<< prints for value, optionals as their value or "none", ranges as {a, b, c},
+     *         or "(unprintable)" if none of these work
+     */
+    template<typename T>
+    std::string toDisplay(const T &value) {
+        if constexpr(requires(std::ostream &os) { os << value; }) {
+            std::ostringstream text;
+            text << value;
+            return text.str();
+        }
+        else if constexpr(requires { value.has_value(); *value; }) { // std::optional and the like
+            return value.has_value() ? toDisplay(*value) : "none";
+        }
+        else if constexpr(std::ranges::input_range<const T>) {
+            std::string text = "{";
+            for(const auto &element : value) {
+                text += (text.size() > 1 ? ", " : "") + toDisplay(element);
+            }
+            return text + "}";
+        }
+        else {
+            return "(unprintable)";
+        }
+    }
+
+    /**
+     * @brief The readable name of a type, e.g. "std::invalid_argument"
+     * @tparam T The type
+     * @return The demangled name where the compiler supports it, typeid(T).name() otherwise
+     */
+    template<typename T>
+    std::string typeName() {
+#if defined(__GNUG__)
+        int status = 0;
+        std::unique_ptr<char, void (*)(void *)> name(abi::__cxa_demangle(typeid(T).name(), nullptr, nullptr, &status), std::free);
+        if(status == 0 && name) {
+            return name.get();
+        }
+#endif
+        return typeid(T).name();
+    }
+
+    /**
+     * @brief Turns the schedule perturbation of schedulePoint on with a seed, 0 turns it off
+     */
+    inline std::atomic<std::uint64_t> scheduleSeed = 0;
+
+    /**
+     * @brief A point where testDeterministic may delay the calling thread, a no-op otherwise
+     *
+     * parallelFor calls it before every chunk; parallel code under test can call it wherever a different
+     * interleaving could change its output, e.g. before merging a partial result. While scheduleSeed is set, every
+     * thread draws from its own random stream whether to go on, yield, spin or sleep for a few microseconds.
+     */
+    inline void schedulePoint() {
+        std::uint64_t seed = scheduleSeed.load(std::memory_order_relaxed);
+        if(seed == 0) {
+            return;
+        }
+        thread_local std::uint64_t state = 0;
+        thread_local std::uint64_t stateSeed = 0;
+        if(stateSeed != seed) {
+            stateSeed = seed;
+            state = seed ^ std::hash<std::thread::id>()(std::this_thread::get_id());
+        }
+        state += 0x9E3779B97F4A7C15ULL; // splitmix64
+        std::uint64_t random = state;
+        random = (random ^ (random >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        random = (random ^ (random >> 27)) * 0x94D049BB133111EBULL;
+        random ^= random >> 31;
+        switch(random & 7) {
+            case 0:
+            case 1:
+                std::this_thread::yield();
+                break;
+            case 2:
+                for(std::uint64_t spin = (random >> 8) & 4095; spin > 0; spin--) {
+                    std::atomic_signal_fence(std::memory_order_seq_cst); // keeps the loop
+                }
+                break;
+            case 3:
+                std::this_thread::sleep_for(std::chrono::microseconds((random >> 8) & 63));
+                break;
+            default:
+                break;
+        }
+    }
+
+    /**
+     * @brief Folds a value into a 64 bit FNV-1a hash, bit for bit for numbers and element by element for ranges
+     * @tparam T Any arithmetic, string, range, pair or tuple type, or anything toDisplay can print
+     * @param value The value
+     * @param hash The hash to update
+     */
+    template<typename T>
+    void hashValue(const T &value, std::uint64_t &hash) {
+        auto bytes = [&hash](const void *data, std::size_t size) {
+            for(std::size_t i = 0; i < size; i++) {
+                hash = (hash ^ static_cast<const unsigned char *>(data)[i]) * 0x100000001B3ULL;
+            }
+        };
+        if constexpr(std::is_arithmetic_v<T> || std::is_enum_v<T>) {
+            bytes(&value, sizeof(T));
+        }
+        else if constexpr(std::is_convertible_v<const T &, std::string_view>) {
+            std::string_view text = value;
+            bytes(text.data(), text.size());
+        }
+        else if constexpr(std::ranges::input_range<const T>) {
+            std::uint64_t count = 0;
+            for(const auto &element : value) {
+                hashValue(element, hash);
+                count++;
+            }
+            bytes(&count, sizeof(count));
+        }
+        else if constexpr(requires { std::tuple_size<T>::value; }) {
+            std::apply([&hash](const auto &... parts) { (hashValue(parts, hash), ...); }, value);
+        }
+        else {
+            std::string text = toDisplay(value);
+            bytes(text.data(), text.size());
+        }
+    }
+
+    /**
+     * @brief Like toDisplay, but floating point values keep every digit and ranges print one element per line
+     * @tparam T Any type toDisplay takes
+     * @param value The value
+     * @return The text, made to be compared with a diff tool
+     */
+    template<typename T>
+    std::string toExactDisplay(const T &value) {
+        if constexpr(std::is_floating_point_v<T>) {
+            char text[64];
+            auto [end, error] = std::to_chars(text, text + sizeof(text), value);
+            return error == std::errc() ? std::string(text, end) : toDisplay(value);
+        }
+        else if constexpr(std::ranges::input_range<const T> && !std::is_convertible_v<const T &, std::string_view>) {
+            std::string text;
+            for(const auto &element : value) {
+                text += toExactDisplay(element) + "\n";
+            }
+            return text;
+        }
+        else {
+            return toDisplay(value);
+        }
+    }
+
+    /**
+     * @brief Runs body over [0, count) in chunks spread across threads
+     * @tparam Body A Callable taking (std::size_t begin, std::size_t end)
+     * @param count The number of items
+     * @param threads The number of threads to use, 0 for std::thread::hardware_concurrency
+     * @param chunk How many items a thread takes at once, 0 to pick one
+     * @param body Processes the items [begin, end)
+     *
+     * The calling thread works as well. If body throws, the remaining chunks are skipped and the first
+     * exception is rethrown on the calling thread.
+     */
+    template<typename Body>
+    void parallelFor(std::size_t count, unsigned int threads, std::size_t chunk, Body body) {
+        if(threads == 0) {
+            threads = std::max(1u, std::thread::hardware_concurrency());
+        }
+        if(chunk == 0) {
+            chunk = std::max<std::size_t>(1, count / (static_cast<std::size_t>(threads) * 8));
+        }
+        threads = static_cast<unsigned int>(std::min<std::size_t>(threads, (count + chunk - 1) / chunk));
+        if(threads <= 1) {
+            for(std::size_t begin = 0; begin < count; begin += chunk) {
+                body(begin, std::min(count, begin + chunk));
+            }
+            return;
+        }
+        std::atomic<std::size_t> next = 0;
+        std::atomic<bool> stop = false;
+        std::exception_ptr error;
+        std::mutex errorMutex;
+        auto work = [&] {
+            while(!stop.load(std::memory_order_relaxed)) {
+                schedulePoint();
+                std::size_t begin = next.fetch_add(chunk);
+                if(begin >= count) {
+                    return;
+                }
+                try {
+                    body(begin, std::min(count, begin + chunk));
+                }
+                catch(...) {
+                    std::lock_guard<std::mutex> guard(errorMutex);
+                    if(!error) {
+                        error = std::current_exception();
+                    }
+                    stop = true;
+                }
+            }
+        };
+        std::vector<std::thread> workers;
+        for(unsigned int t = 1; t < threads; t++) {
+            workers.emplace_back(work);
+        }
+        work();
+        for(std::thread &worker : workers) {
+            worker.join();
+        }
+        if(error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief The p-value of a chi-square statistic, the regularized upper incomplete gamma function Q(df / 2, statistic / 2)
+     * @param statistic The chi-square statistic
+     * @param degreesOfFreedom The degrees of freedom
+     * @return The probability of a statistic at least this large if the hypothesis holds
+     */
+    inline double chiSquarePValue(double statistic, double degreesOfFreedom) {
+        if(statistic <= 0 || degreesOfFreedom <= 0) {
+            return 1;
+        }
+        double a = degreesOfFreedom / 2;
+        double x = statistic / 2;
+        double logPrefix = a * std::log(x) - x - std::lgamma(a);
+        if(x < a + 1) { // the series of P(a, x) converges quickly here
+            double term = 1 / a;
+            double sum = term;
+            for(int n = 1; n < 10000 && std::abs(term) > std::abs(sum) * 1e-15; n++) {
+                term *= x / (a + n);
+                sum += term;
+            }
+            return std::clamp(1 - sum * std::exp(logPrefix), 0.0, 1.0);
+        }
+        // otherwise the continued fraction of Q(a, x), evaluated with Lentz's method
+        double tiny = 1e-300;
+        double b = x + 1 - a;
+        double c = 1 / tiny;
+        double d = 1 / b;
+        double h = d;
+        for(int n = 1; n < 10000; n++) {
+            double an = -n * (n - a);
+            b += 2;
+            d = an * d + b;
+            d = std::abs(d) < tiny ? tiny : d;
+            c = b + an / c;
+            c = std::abs(c) < tiny ? tiny : c;
+            d = 1 / d;
+            double delta = d * c;
+            h *= delta;
+            if(std::abs(delta - 1) < 1e-15) {
+                break;
+            }
+        }
+        return std::clamp(std::exp(logPrefix) * h, 0.0, 1.0);
+    }
+
+    /**
+     * @brief The p-value of a Kolmogorov-Smirnov statistic
+     * @param distance The largest distance between the empirical and the expected CDF
+     * @param samples The number of samples
+     * @return The asymptotic probability of a distance at least this large if the samples follow the expected CDF
+     */
+    inline double kolmogorovPValue(double distance, std::size_t samples) {
+        double root = std::sqrt(static_cast<double>(samples));
+        double lambda = (root + 0.12 + 0.11 / root) * distance;
+        if(lambda < 0.2) {
+            return 1;
+        }
+        double sum = 0;
+        for(int k = 1; k <= 100; k++) {
+            double term = std::exp(-2.0 * k * k * lambda * lambda);
+            sum += (k % 2 == 1 ? term : -term);
+            if(term < 1e-16) {
+                break;
+            }
+        }
+        return std::clamp(2 * sum, 0.0, 1.0);
+    }
+
 
     /**
      *  @brief A class that holds the result of all tests.
@@ -66,6 +438,7 @@ namespace TesterLib {
         bool state;
         int groupNum = 0;
         int testNum = 0;
+        long long durationNs = 0; // how long the test ran, 0 if it was not measured
         Result(std::string m, bool s, int group = 0, int test = 0) {
             message = std::move(m);
             state = s;
@@ -82,6 +455,55 @@ namespace TesterLib {
             return os;
         }
 
+        /**
+         * @brief The size of a serialized result without its message
+         */
+        static constexpr std::size_t serializedHeader = 1 + 2 * sizeof(std::int32_t) + sizeof(std::int64_t) + sizeof(std::uint32_t);
+
+        /**
+         * @brief Appends a binary copy of the result to out, read back with deserialize
+         * @param out The buffer to append to
+         */
+        void serialize(std::string &out) const {
+            auto length = static_cast<std::uint32_t>(message.size());
+            auto duration = static_cast<std::int64_t>(durationNs);
+            char header[serializedHeader];
+            header[0] = static_cast<char>(state);
+            std::memcpy(header + 1, &groupNum, sizeof(std::int32_t));
+            std::memcpy(header + 1 + sizeof(std::int32_t), &testNum, sizeof(std::int32_t));
+            std::memcpy(header + 1 + 2 * sizeof(std::int32_t), &duration, sizeof(std::int64_t));
+            std::memcpy(header + serializedHeader - sizeof(std::uint32_t), &length, sizeof(std::uint32_t));
+            out.append(header, sizeof(header));
+            out.append(message);
+        }
+
+        /**
+         * @brief Reads a result written by serialize
+         * @param data Where to read from, moved past the result on success
+         * @param end The end of the buffer
+         * @param result Set to the result that was read
+         * @return false if the buffer does not hold a whole result
+         */
+        static bool deserialize(const char *&data, const char *end, Result &result) {
+            if(end - data < static_cast<std::ptrdiff_t>(serializedHeader)) {
+                return false;
+            }
+            std::uint32_t length = 0;
+            std::int64_t duration = 0;
+            std::memcpy(&length, data + serializedHeader - sizeof(std::uint32_t), sizeof(std::uint32_t));
+            if(static_cast<std::size_t>(end - data) - serializedHeader < length) {
+                return false;
+            }
+            result.state = data[0] != 0;
+            std::memcpy(&result.groupNum, data + 1, sizeof(std::int32_t));
+            std::memcpy(&result.testNum, data + 1 + sizeof(std::int32_t), sizeof(std::int32_t));
+            std::memcpy(&duration, data + 1 + 2 * sizeof(std::int32_t), sizeof(std::int64_t));
+            result.durationNs = duration;
+            result.message.assign(data + serializedHeader, length);
+            data += serializedHeader + length;
+            return true;
+        }
+
         std::string toString() {
             return std::string(" \x1b[35m Group " + std::to_string(groupNum) + "\x1b[0m,\x1b[36m Test " + std::to_string(testNum)
                     + "\x1b[0m\tResult: " + (state ? "\x1b[42m true \x1b[0m" : "\x1b[41m false \x1b[0m") + std::string(" | Message: ") + message);
@@ -89,497 +511,3837 @@ namespace TesterLib {
     };
 
     /**
-     *  @brief A class that is the parent of all Tests except Tester
+     * @brief Prints the progress of long running tests to a stream at a fixed interval
      *
-     *  @tparam T The type of the data that you are testing the value for
-     *  @tparam U the type of the data that you are comparing against for a truth value
-     *  */
-    template<class T, class U>
-    class Test {
-    protected:
-        T data;
-        U expected;
-        std::string message;
-        int groupNum;
+     * The test loops of TestRange and TestTwoVector count every finished test with relaxed atomic increments, which
+     * is cheap enough to leave on for a sweep of millions of tests. A background thread reads the counters and
+     * prints how many tests are done, how many failed, the rate, an estimate of the remaining time and the last
+     * failure, so a slow run can be told apart from a hung one. Attach it with Tester::setProgress.
+     */
+    class ProgressReporter {
+    private:
+        std::chrono::milliseconds interval;
+        std::ostream &out;
+        std::thread worker;
+        std::mutex mutex;
+        std::condition_variable wake;
+        bool stopping = false;
+        std::chrono::steady_clock::time_point started = std::chrono::steady_clock::now();
+
     public:
-        Test(T Data, T Expected, std::string Message, int group = 0) {
-            data = Data;
-            expected = Expected;
-            message = std::move(Message);
-            groupNum = group;
+        std::atomic<unsigned long long> total = 0;
+        std::atomic<unsigned long long> done = 0;
+        std::atomic<unsigned long long> passed = 0;
+        std::atomic<unsigned long long> failed = 0;
+        std::atomic<int> lastFailedGroup = 0;
+        std::atomic<int> lastFailedTest = 0;
+
+        /**
+         * @brief Constructor
+         * @param Interval How often to print
+         * @param Out Where to print
+         */
+        explicit ProgressReporter(std::chrono::milliseconds Interval = std::chrono::seconds(1), std::ostream &Out = std::cerr) : interval(Interval), out(Out) {}
+
+        ~ProgressReporter() {
+            Stop();
         }
-        ~Test() = default;
 
-        virtual Result Run() {
-            return {"", false};
+        ProgressReporter(const ProgressReporter &) = delete;
+        ProgressReporter &operator=(const ProgressReporter &) = delete;
+
+        /**
+         * @brief Starts printing from a background thread
+         */
+        void Start() {
+            std::lock_guard<std::mutex> guard(mutex);
+            if(worker.joinable()) {
+                return;
+            }
+            stopping = false;
+            started = std::chrono::steady_clock::now();
+            worker = std::thread([this] {
+                std::unique_lock<std::mutex> lock(mutex);
+                while(!wake.wait_for(lock, interval, [this] { return stopping; })) {
+                    out << Line() << std::endl;
+                }
+            });
         }
-    };
 
+        /**
+         * @brief Stops the background thread and prints a last line
+         */
+        void Stop() {
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                if(!worker.joinable()) {
+                    return;
+                }
+                stopping = true;
+            }
+            wake.notify_all();
+            worker.join();
+            out << Line() << std::endl;
+        }
 
-    /**
-     *  @brief A class that can return floating point comparison with a range for imprecision.
-     *  @class Inherits from TesterLib::Test
-     *
-     *  @tparam T The type of the data that you are testing the value for, expected to be either **float** or **double**
-     *  @tparam U the type of the data that you are comparing against for a truth value, expected to be either **float** or **double**
-     *  */
-    template<class T, class U>
-    class TestFloat : public Test<T, U> {
-    private:
-        double upperLimit = 0;
-        double lowerLimit = 0;
-    public:
+        /**
+         * @brief Adds tests to the expected total, used for the percentage and the estimate
+         * @param tests The number of tests that are about to run
+         */
+        void Expect(unsigned long long tests) {
+            total.fetch_add(tests, std::memory_order_relaxed);
+        }
 
         /**
-         * @brief Range constructor where upperLimit and lowerLimit are range away from 0
-         * @param data Actual data
-         * @param expected Expected data
-         * @param range Range of the limit from 0, + or -
+         * @brief Counts a finished test
+         * @param state Whether the test passed
+         * @param group The group number of the test
+         * @param test The test number
          */
-        TestFloat(T data, U expected, double range, std::string message = "", int group = 0) : Test<T, U>(data, expected, message, group) {
-            upperLimit = range;
-            lowerLimit = -range;
+        void Record(bool state, int group, int test) {
+            done.fetch_add(1, std::memory_order_relaxed);
+            if(state) {
+                passed.fetch_add(1, std::memory_order_relaxed);
+            }
+            else {
+                failed.fetch_add(1, std::memory_order_relaxed);
+                lastFailedGroup.store(group, std::memory_order_relaxed);
+                lastFailedTest.store(test, std::memory_order_relaxed);
+            }
         }
 
         /**
-         * @brief Range constructor where upperLimit and lowerLimit are set
-         * @param data Actual data
-         * @param expected Expected data
-         * @param lLimit Lower limit
-         * @param uLimit Upper limit
+         * @brief Formats a duration as "5.9s", "4m 05s" or "1h 02m 03s"
          */
-        TestFloat(T data, U expected, double lLimit, double uLimit, std::string message = "", int group = 0) : Test<T, U>(data, expected, message, group) {
-            lowerLimit = lLimit;
-            upperLimit = uLimit;
+        static std::string FormatSeconds(double seconds) {
+            std::ostringstream text;
+            if(seconds < 60) {
+                text << std::fixed << std::setprecision(1) << seconds << "s";
+                return text.str();
+            }
+            auto whole = static_cast<unsigned long long>(seconds);
+            if(whole >= 3600) {
+                text << whole / 3600 << "h " << std::setw(2) << std::setfill('0') << whole % 3600 / 60 << "m ";
+            }
+            else {
+                text << whole / 60 << "m ";
+            }
+            text << std::setw(2) << std::setfill('0') << whole % 60 << "s";
+            return text.str();
         }
 
         /**
-         * @brief Runs the test with lower and upper limit of leniency for floating point imprecision
-         * @return The Result of the test
+         * @brief The progress line, e.g. "Progress: 5000/20000 (25.0%), 4990 passed, 10 failed, 2500.0 tests/s, ETA 6s, last failure: Group 1, Test 4711"
          */
-        Result Run() {
-            bool state = false;
-            std::string result;
-            try {
-                    state = (this->data + lowerLimit <= this->expected && this->data + upperLimit >= this->expected) || this->data == this->expected;
-                    result = std::string(state ? "Passed" : "Failed");
+        std::string Line() const {
+            unsigned long long finished = done.load(std::memory_order_relaxed);
+            unsigned long long expected = total.load(std::memory_order_relaxed);
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+            double rate = seconds > 0 ? static_cast<double>(finished) / seconds : 0;
+            std::ostringstream line;
+            line << std::fixed << std::setprecision(1) << "Progress: " << finished;
+            if(expected > 0) {
+                line << "/" << expected << " (" << 100.0 * static_cast<double>(finished) / static_cast<double>(expected) << "%)";
             }
-            catch(std::exception &e) {
-                result = "Exception Thrown: " + std::string(e.what());
+            line << ", " << passed.load(std::memory_order_relaxed) << " passed, " << failed.load(std::memory_order_relaxed)
+                 << " failed, " << rate << " tests/s";
+            if(expected > finished && rate > 0) {
+                line << ", ETA " << FormatSeconds(static_cast<double>(expected - finished) / rate);
             }
-            return {this->message + " " + result, state, this->groupNum, 1};
+            if(failed.load(std::memory_order_relaxed) > 0) {
+                line << ", last failure: Group " << lastFailedGroup.load(std::memory_order_relaxed) << ", Test "
+                     << lastFailedTest.load(std::memory_order_relaxed);
+            }
+            return line.str();
         }
     };
 
-
     /**
-     * @brief A class that is the parent of all Tests that use a vector for results
-     * @tparam T The type of the expected vector
+     * @brief Writes out the Results recorded so far when a test crashes the process
+     *
+     * Once installed, a SIGSEGV, SIGABRT or SIGBUS writes every Result of the Tester, plus the ones of the group that
+     * was running, to a file in the format of Tester::saveResults (so it can be read back with mergeFile). It then
+     * prints the group and test that were running and a backtrace to stderr, and lets the signal kill the process as
+     * it would have. Only async-signal-safe calls are made in the handler: nothing is allocated and everything is
+     * written with write(2). The test loops of TestRange and TestTwoVector mark every test before running it; with
+     * several threads the test named is the one that started last. Until a handler is installed marking is a single
+     * relaxed load, and fork()ed children of a ForkFixture run without the handler.
      */
-    template<class T>
-    class VectorTest {
-    protected:
-        std::vector<Result> results;
-        std::string message; // something appended to all tests
-        std::vector<std::string> messages; // something appended to nth test
-        std::vector<T> expected;
-        int groupNum;
-    public:
+    class CrashHandler {
+    private:
+        // lock-free atomics, as they are written by the test threads and read in the handler
+        static inline std::atomic<bool> installed = false;
+        static inline std::atomic<const std::vector<std::vector<Result>> *> recorded = nullptr;
+        static inline std::atomic<const std::vector<Result> *> running = nullptr;
+        static inline std::atomic<int> runningGroup = 0;
+        static inline std::atomic<int> runningTest = 0;
+        static inline volatile std::sig_atomic_t handling = 0;
+        static_assert(std::atomic<const std::vector<Result> *>::is_always_lock_free && std::atomic<int>::is_always_lock_free,
+                      "the crash handler needs lock-free atomics");
+        static inline char path[4096] = {};
 
-        explicit VectorTest(std::vector<T> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) {
-            expected = Expected;
-            messages = std::move(Messages);
-            message = std::move(Message);
-            groupNum = group;
+        static constexpr std::uint32_t fileVersion = 2; // the version of Tester::saveResults
+
+#if defined(__unix__) || defined(__APPLE__)
+        static inline char alternateStack[1 << 16];
+
+        static void Write(int fd, const void *data, std::size_t size) {
+            const char *bytes = static_cast<const char *>(data);
+            while(size > 0) {
+                ssize_t written = ::write(fd, bytes, size);
+                if(written <= 0) {
+                    if(written < 0 && errno == EINTR) {
+                        continue;
+                    }
+                    return;
+                }
+                bytes += written;
+                size -= static_cast<std::size_t>(written);
+            }
         }
 
-        explicit VectorTest(std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) {
-            message = std::move(Message);
-            messages = std::move(Messages);
-            groupNum = group;
+        static void WriteText(int fd, const char *text) {
+            Write(fd, text, std::strlen(text));
         }
 
-        ~VectorTest() = default;
-    };
+        static void WriteNumber(int fd, long long value) {
+            char digits[24];
+            int length = 0;
+            unsigned long long magnitude = value < 0 ? 0ULL - static_cast<unsigned long long>(value) : static_cast<unsigned long long>(value);
+            do {
+                digits[sizeof(digits) - 1 - length++] = static_cast<char>('0' + magnitude % 10);
+                magnitude /= 10;
+            } while(magnitude > 0);
+            if(value < 0) {
+                digits[sizeof(digits) - 1 - length++] = '-';
+            }
+            Write(fd, digits + sizeof(digits) - length, static_cast<std::size_t>(length));
+        }
+
+        static void WriteGroup(int fd, const std::vector<Result> &group) {
+            auto count = static_cast<std::uint32_t>(group.size());
+            std::uint64_t bytes = 0;
+            for(const Result &result : group) {
+                bytes += Result::serializedHeader + result.message.size();
+            }
+            Write(fd, &count, sizeof(count));
+            Write(fd, &bytes, sizeof(bytes));
+            for(const Result &result : group) {
+                auto state = static_cast<char>(result.state);
+                auto duration = static_cast<std::int64_t>(result.durationNs);
+                auto length = static_cast<std::uint32_t>(result.message.size());
+                Write(fd, &state, 1);
+                Write(fd, &result.groupNum, sizeof(std::int32_t));
+                Write(fd, &result.testNum, sizeof(std::int32_t));
+                Write(fd, &duration, sizeof(duration));
+                Write(fd, &length, sizeof(length));
+                Write(fd, result.message.data(), result.message.size());
+            }
+        }
+
+        static void Handle(int signal) {
+            if(handling) {
+                ::raise(signal);
+                return;
+            }
+            handling = 1;
+            const std::vector<Result> *partial = running.load();
+            const std::vector<std::vector<Result>> *all = recorded.load();
+            int group = runningGroup.load();
+            int test = runningTest.load();
+            std::size_t groups = all == nullptr ? 0 : all->size();
+            // the running group is only missing from the Tester until its results are added
+            bool writePartial = partial != nullptr && static_cast<std::size_t>(group) > groups;
+            long long written = 0;
+            int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if(fd >= 0) {
+                auto count = static_cast<std::uint32_t>(groups + (writePartial ? 1 : 0));
+                Write(fd, "TLRS", 4);
+                Write(fd, &fileVersion, sizeof(fileVersion));
+                Write(fd, &count, sizeof(count));
+                for(std::size_t g = 0; g < groups; g++) {
+                    WriteGroup(fd, (*all)[g]);
+                    written += static_cast<long long>((*all)[g].size());
+                }
+                if(writePartial) {
+                    WriteGroup(fd, *partial);
+                    written += static_cast<long long>(partial->size());
+                }
+                ::close(fd);
+            }
+            WriteText(STDERR_FILENO, "\nTester: caught signal ");
+            WriteNumber(STDERR_FILENO, signal);
+            WriteText(STDERR_FILENO, " in group ");
+            WriteNumber(STDERR_FILENO, group);
+            WriteText(STDERR_FILENO, ", test ");
+            WriteNumber(STDERR_FILENO, test);
+            WriteText(STDERR_FILENO, fd >= 0 ? "; " : "; could not write ");
+            WriteNumber(STDERR_FILENO, written);
+            WriteText(STDERR_FILENO, " results written to ");
+            WriteText(STDERR_FILENO, path);
+            WriteText(STDERR_FILENO, "\n");
+#if defined(__GLIBC__) || defined(__APPLE__)
+            void *frames[64];
+            int depth = ::backtrace(frames, 64);
+            ::backtrace_symbols_fd(frames, depth, STDERR_FILENO);
+#endif
+            ::raise(signal); // the handler was reset to the default one, so this ends the process
+        }
+#endif
 
-    /**
-      *  @brief A class that can return a list of Results that input a range of integers into a function as a first parameter
-      *  Range is inclusive
-      *
-      *  @tparam U The return type that the function/lambda will return
-      *  */
-    template<class U>
-    class TestRange : public VectorTest<U> {
-    private:
-        int from;
-        int to;
     public:
         /**
-         * @brief No expected constructor
-         * @param From the integer to start the range from
-         * @param To the integer to end the range to
-         * @param Message optional message that will print for every result
-         * @param Messages optional message that will print for nth result
+         * @brief Installs the handler for SIGSEGV, SIGABRT and SIGBUS
+         * @param results The results of the Tester, written out on a crash
+         * @param file Where to write them
+         * @return false if the handler could not be installed, or signals are not supported
+         *
+         * Use Tester::installCrashHandler instead of calling this directly.
          */
-        TestRange(int From, int To, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : from(From), to(To), VectorTest<U>(Message, Messages, group) {}
-
-        /**
-         * @brief Expected constructor
-         * @param From the integer to start the range from
-         * @param To the integer to end the range to
-         * @param Expected an std::vector<U> that has the list of expected values for each test, in order
-         * @param Message optional message that will print for every result
-         * @param Messages optional message that will print for nth result
+        static bool Install(const std::vector<std::vector<Result>> &results, const std::string &file) {
+#if defined(__unix__) || defined(__APPLE__)
+            if(file.size() >= sizeof(path)) {
+                return false;
+            }
+            std::memcpy(path, file.c_str(), file.size() + 1);
+            recorded = &results;
+#if defined(__GLIBC__) || defined(__APPLE__)
+            // the first backtrace() loads the unwinder, which allocates, so do it now rather than in the handler
+            void *frame[1];
+            ::backtrace(frame, 1);
+#endif
+            // an alternate stack, so that a stack overflow can still be handled
+            stack_t stack{};
+            stack.ss_sp = alternateStack;
+            stack.ss_size = sizeof(alternateStack);
+            ::sigaltstack(&stack, nullptr);
+            struct sigaction action{};
+            action.sa_handler = Handle;
+            action.sa_flags = SA_RESETHAND | SA_NODEFER | SA_ONSTACK;
+            sigemptyset(&action.sa_mask);
+            for(int signal : {SIGSEGV, SIGABRT, SIGBUS}) {
+                if(::sigaction(signal, &action, nullptr) != 0) {
+                    return false;
+                }
+            }
+            installed = true;
+            return true;
+#else
+            (void)results;
+            (void)file;
+            return false;
+#endif
+        }
+
+        /**
+         * @brief Marks a test as running, called by the test loops before every test
+         * @param group The group number
+         * @param test The test number
+         * @param results The results of the group so far
          */
-        TestRange(int From, int To, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : from(From), to(To), VectorTest<U>(Expected, Message, Messages, group) {}
+        static void Running(int group, int test, const std::vector<Result> *results) {
+            if(!installed.load(std::memory_order_relaxed)) {
+                return;
+            }
+            runningGroup.store(group, std::memory_order_relaxed);
+            runningTest.store(test, std::memory_order_relaxed);
+            running.store(results, std::memory_order_release);
+        }
 
-        ~TestRange() = default;
+        /**
+         * @brief Forgets the results of a group that is being destroyed, unless another group ran since
+         */
+        static void Forget(const std::vector<Result> *results) {
+            if(installed.load(std::memory_order_relaxed)) {
+                running.compare_exchange_strong(results, nullptr);
+            }
+        }
 
         /**
-         * @brief Update the test
-         * @param From the integer to start the range from
-         * @param To the integer to end the range to
-         * @param Message optional message that will print for every result
-         * @param Messages optional messages that will print for nth result
+         * @brief Restores the default action of the signals, called in fork()ed children
+         *
+         * A child has a stale copy of the results, so a crash in it must neither print as the Tester's crash nor
+         * overwrite the file of the parent.
          */
-        void UpdateTest(int From, int To, std::string Message = "", std::vector<std::string> Messages = {}) {
-            from = From;
-            to = To;
-            this->message = std::move(Message);
-            this->messages = std::move(Messages);
+        static void UninstallInChild() {
+#if defined(__unix__) || defined(__APPLE__)
+            if(!installed.load(std::memory_order_relaxed)) {
+                return;
+            }
+            installed = false;
+            recorded = nullptr;
+            running = nullptr;
+            for(int signal : {SIGSEGV, SIGABRT, SIGBUS}) {
+                ::signal(signal, SIG_DFL);
+            }
+#endif
         }
 
         /**
-         * @brief Update the test
-         * @param From the integer to start the range from
-         * @param To the integer to end the range to
-         * @param Expected an std::vector<U> that has the list of expected values for each test, in order
-         * @param Message optional message that will print for every result
-         * @param Messages optional messages that will print for nth result
+         * @brief Points the handler at other results if it writes these, called when a Tester is moved or destroyed
+         * @param results The results that go away
+         * @param replacement Where they went, nullptr if the Tester is destroyed
          */
-        void UpdateTest(int From, int To, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}) {
-            from = From;
-            to = To;
-            this->message = std::move(Message);
-            this->expected = Expected;
-            this->messages = std::move(Messages);
+        static void Replace(const std::vector<std::vector<Result>> *results, const std::vector<std::vector<Result>> *replacement) {
+            recorded.compare_exchange_strong(results, replacement);
+        }
+    };
+
+    /**
+     * @brief The encoding of the frames an EventPublisher sends
+     *
+     * Json sends one object per line. Binary sends a 1 byte event type and a 4 byte payload length before every
+     * payload, with integers in the byte order of the machine.
+     */
+    enum class EventFormat {Json, Binary};
+
+    /**
+     * @brief Streams test events to a Unix domain socket or a pipe, for dashboards and IDEs
+     *
+     * The test loops of TestRange and TestTwoVector publish a "started" event before every test and a "finished"
+     * event after it, and the Tester publishes a "summary" event when one of these groups is done. Publishing never
+     * blocks: events go to a bounded buffer guarded by a mutex that is only tried, and a background thread encodes
+     * them and writes them without blocking. When the buffer is full, the lock is taken or the consumer does not keep
+     * up, events are dropped and only counted, and the next frame that gets out is a "dropped" frame with how many
+     * events were lost and how many of the lost tests passed and failed.
+     */
+    class EventPublisher {
+    public:
+        enum class Kind : std::uint8_t {Started = 1, Finished = 2, Summary = 3, Dropped = 4};
+
+    private:
+        struct Event {
+            Kind kind;
+            std::int32_t group;
+            std::int32_t test;
+            bool state;
+            std::uint64_t passed; // only used by Summary and Dropped
+            std::uint64_t failed;
+            std::uint64_t count; // only used by Dropped, the number of lost events
+            std::string message; // only used by Finished of failed tests
+        };
+
+        int fd = -1;
+        bool ownsFd = false;
+        bool isSocket = true; // until send fails with ENOTSOCK, only used by the writer thread
+        EventFormat format;
+        std::size_t capacity;
+        std::size_t maxPending;
+        std::mutex lock;
+        std::condition_variable wake;
+        std::vector<Event> buffer;
+        std::atomic<std::uint64_t> dropped{0}; // since the last "dropped" frame
+        std::atomic<std::uint64_t> totalDropped{0};
+        std::atomic<std::uint64_t> droppedPassed{0};
+        std::atomic<std::uint64_t> droppedFailed{0};
+        std::atomic<std::uint64_t> sent{0};
+        std::atomic<bool> running{false};
+        std::thread writer;
+        std::string pending; // encoded bytes the consumer has not taken yet
+
+        void Push(Event &&event) {
+            std::unique_lock<std::mutex> guard(lock, std::try_to_lock);
+            if(!guard.owns_lock() || buffer.size() >= capacity) {
+                Drop(event);
+                return;
+            }
+            buffer.push_back(std::move(event));
+            if(buffer.size() == capacity / 2) {
+                wake.notify_one();
+            }
+        }
+
+        void Drop(const Event &event) {
+            totalDropped.fetch_add(1, std::memory_order_relaxed);
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            if(event.kind == Kind::Finished) {
+                (event.state ? droppedPassed : droppedFailed).fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+
+        template<typename T>
+        static void Put(std::string &out, T value) {
+            out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        void Encode(const Event &event, std::string &out) const {
+            if(format == EventFormat::Json) {
+                switch(event.kind) {
+                    case Kind::Started:
+                        out += "{\"event\":\"started\",\"group\":" + std::to_string(event.group) + ",\"test\":" + std::to_string(event.test) + "}\n";
+                        break;
+                    case Kind::Finished:
+                        out += "{\"event\":\"finished\",\"group\":" + std::to_string(event.group) + ",\"test\":" + std::to_string(event.test)
+                               + ",\"state\":" + (event.state ? "true" : "false");
+                        if(!event.message.empty()) {
+                            out += ",\"message\":";
+                            appendJsonString(out, event.message);
+                        }
+                        out += "}\n";
+                        break;
+                    case Kind::Summary:
+                        out += "{\"event\":\"summary\",\"group\":" + std::to_string(event.group) + ",\"passed\":" + std::to_string(event.passed)
+                               + ",\"failed\":" + std::to_string(event.failed) + "}\n";
+                        break;
+                    case Kind::Dropped:
+                        out += "{\"event\":\"dropped\",\"count\":" + std::to_string(event.count)
+                               + ",\"passed\":" + std::to_string(event.passed) + ",\"failed\":" + std::to_string(event.failed) + "}\n";
+                        break;
+                }
+                return;
+            }
+            std::string payload;
+            switch(event.kind) {
+                case Kind::Started:
+                    Put(payload, event.group);
+                    Put(payload, event.test);
+                    break;
+                case Kind::Finished:
+                    Put(payload, event.group);
+                    Put(payload, event.test);
+                    Put(payload, static_cast<std::uint8_t>(event.state));
+                    Put(payload, static_cast<std::uint32_t>(event.message.size()));
+                    payload += event.message;
+                    break;
+                case Kind::Summary:
+                    Put(payload, event.group);
+                    Put(payload, event.passed);
+                    Put(payload, event.failed);
+                    break;
+                case Kind::Dropped:
+                    Put(payload, event.count);
+                    Put(payload, event.passed);
+                    Put(payload, event.failed);
+                    break;
+            }
+            Put(out, static_cast<std::uint8_t>(event.kind));
+            Put(out, static_cast<std::uint32_t>(payload.size()));
+            out += payload;
         }
 
         /**
-         * @brief Run all of the tests
-         * @param method A callable function, lambda or method
-         * @param args The list of arguments to be passed onto the Callable
-         * @return A vector of Result with the results
-         *
-         * This will run through all of the tests from `from` and to `to`, inclusive.
-         * It will input the current value of the range as the first parameter into the function.
-         * This MUST be the first parameter of the function or else it WILL throw a template error
-         * All other arguments will then be passed through.
-         * If supplied, it will check against the expected vector.
-         *
+         * @brief Writes as much of pending as the consumer takes without blocking
+         * @return false if the consumer went away
          */
-        template<typename Callable, typename... Args>
-        std::vector<Result> RunAllArgs(Callable& method, Args... args) {
-            int index = 0;
-            for(int i = from; i <= to; i++) {
-                bool state = false;
-                std::string result;
-                try {
-                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
-                        std::invoke(method, i, args...);
-                        result = std::string("Passed: ") + std::to_string(i);
+        bool Flush() {
+#if defined(__unix__) || defined(__APPLE__)
+            while(!pending.empty()) {
+                ssize_t written = -1;
+                if(isSocket) {
+#if defined(MSG_NOSIGNAL)
+                    written = ::send(fd, pending.data(), pending.size(), MSG_DONTWAIT | MSG_NOSIGNAL);
+#else
+                    written = ::send(fd, pending.data(), pending.size(), MSG_DONTWAIT);
+#endif
+                    isSocket = !(written < 0 && errno == ENOTSOCK);
+                }
+                if(!isSocket) {
+                    written = ::write(fd, pending.data(), pending.size()); // a pipe, made non-blocking when connected
+                }
+                if(written < 0) {
+                    if(errno == EINTR) {
+                        continue;
                     }
-                    else {
-                        // if expected is smaller than range, we just use the last value as expected
-                        state = std::invoke(method, i, args...) == this->expected.at(std::min<unsigned long long>(this->expected.size() - 1, index));
-                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
+                    if(errno == EPIPE) { // the reader is gone, take the SIGPIPE that the writer thread blocks
+#if defined(__linux__)
+                        sigset_t pipe;
+                        sigemptyset(&pipe);
+                        sigaddset(&pipe, SIGPIPE);
+                        timespec now{};
+                        ::sigtimedwait(&pipe, nullptr, &now);
+#endif
+                        return false;
                     }
+                    return errno == EAGAIN || errno == EWOULDBLOCK;
                 }
-                catch(std::exception &e) {
-                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
-                }
-                this->results.emplace_back(this->message + " " + result + (index < this->messages.size() ? ", " + this->messages.at(index) : ""), state, this->groupNum, index + 1);
-                index++;
+                pending.erase(0, static_cast<std::size_t>(written));
             }
-            return this->results;
+#endif
+            return true;
         }
 
-        // we have the exact same function here except due to template issues, this one does not have args.
-        // this **will** throw a compile time error if it is used with a function
-        /**
-         * @brief Run all of the tests
-         * @param method A callable function, lambda or method
-         * @return A vector of Result with the results
-         *
-         * This will run through all of the tests from `from` and to `to`, inclusive.
-         * It will input the current value of the range as the first parameter into the function.
-         * This is designed for functions that specifically take in *1* parameter of type int
-         * If supplied, it will check against the expected vector.
-         *
-         */
-        template<typename Callable>
-        std::vector<Result> RunAllNoArgs(Callable& method) {
-            int index = 0;
-            for(int i = from; i <= to; i++) {
-                bool state = false;
-                std::string result;
-                try {
-                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
-                        std::invoke(method, i);
-                        result = std::string("Passed: ") + std::to_string(i);
+        void Write() {
+#if defined(__unix__) || defined(__APPLE__)
+            // write(2) to a pipe without a reader raises SIGPIPE, which would end the tests instead of this thread
+            sigset_t pipe;
+            sigemptyset(&pipe);
+            sigaddset(&pipe, SIGPIPE);
+            ::pthread_sigmask(SIG_BLOCK, &pipe, nullptr);
+#endif
+            std::vector<Event> taken;
+            taken.reserve(capacity);
+            bool connected = true;
+            while(true) {
+                bool stopping;
+                {
+                    std::unique_lock<std::mutex> guard(lock);
+                    wake.wait_for(guard, std::chrono::milliseconds(20), [this] { return !running.load() || buffer.size() * 2 >= capacity; });
+                    taken.swap(buffer);
+                    stopping = !running.load();
+                }
+                if(pending.size() >= maxPending) { // the consumer is behind, so everything taken is lost as well
+                    for(const Event &event : taken) {
+                        Drop(event);
                     }
-                    else {
-                        // if expected is smaller than range, we just use the last value as expected
-                         state = std::invoke(method, i) == this->expected.at(std::min<unsigned long long>(this->expected.size() - 1, index));
-                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
+                }
+                else {
+                    std::uint64_t lost = dropped.exchange(0, std::memory_order_relaxed);
+                    std::uint64_t lostPassed = droppedPassed.exchange(0, std::memory_order_relaxed);
+                    std::uint64_t lostFailed = droppedFailed.exchange(0, std::memory_order_relaxed);
+                    if(lost > 0) {
+                        Encode({Kind::Dropped, 0, 0, false, lostPassed, lostFailed, lost, {}}, pending);
+                    }
+                    for(const Event &event : taken) {
+                        Encode(event, pending);
                     }
+                    sent.fetch_add(taken.size(), std::memory_order_relaxed);
                 }
-                catch(std::exception &e) {
-                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
+                taken.clear();
+                if(connected) {
+                    connected = Flush();
+                }
+                if(!connected) {
+                    pending.clear();
+                }
+                if(stopping) {
+                    return;
                 }
-                this->results.emplace_back(this->message + " " + result + (index < this->messages.size() ? ", " + this->messages.at(index) : ""), state, this->groupNum, index + 1);
-                index++;
             }
-            return this->results;
         }
 
+    public:
         /**
-         * @brief Run all of the tests
-         * @param method A callable function, lambda or method
-         * @param args The list of arguments to be passed onto the Callable
-         * @return A vector of Result with the results
-         *
-         * This will run through all of the tests from `from` and to `to`, inclusive.
-         * It will input the current value of the range as the first parameter into the function.
-         * This MUST be the first parameter of the function or else it WILL throw a template error
-         * All other arguments will then be passed through.
-         * If supplied, it will check against the expected vector.
-         *
+         * @brief Publishes to a file descriptor, e.g. a pipe or a connected socket, which is made non-blocking
+         * @param Fd The file descriptor, it is not closed by the publisher
+         * @param Format How the frames are encoded
+         * @param Capacity How many events the buffer holds before they are dropped
          */
-        template<typename Callable, typename... Args>
-        std::vector<Result> RunAll(Callable& method, Args... args) {
-            return RunAllArgs(method, args...);
+        explicit EventPublisher(int Fd, EventFormat Format = EventFormat::Json, std::size_t Capacity = 65536)
+            : fd(Fd), format(Format), capacity(std::max<std::size_t>(1, Capacity)), maxPending(std::max<std::size_t>(1, Capacity) * 64) {
+            buffer.reserve(capacity);
+#if defined(__unix__) || defined(__APPLE__)
+            if(fd >= 0) {
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+            }
+#endif
         }
 
         /**
-         * @brief Run all of the tests
-         * @param method A callable function, lambda or method
-         * @return A vector of Result with the results
-         *
-         * This will run through all of the tests from `from` and to `to`, inclusive.
-         * It will input the current value of the range as the first parameter into the function.
-         * This is designed for functions that specifically take in *1* parameter of type int
-         * If supplied, it will check against the expected vector.
+         * @brief Connects to a Unix domain stream socket and publishes to it
+         * @param path The path of the socket the dashboard listens on
+         * @param Format How the frames are encoded
+         * @param Capacity How many events the buffer holds before they are dropped
          *
+         * If the socket cannot be connected, Connected() is false and every event is dropped.
          */
-        template<typename Callable>
-        std::vector<Result> RunAll(Callable& method) {
-            return RunAllNoArgs( method); // use 0 as default argument, but won't be used
+        explicit EventPublisher(const std::string &path, EventFormat Format = EventFormat::Json, std::size_t Capacity = 65536)
+            : EventPublisher(-1, Format, Capacity) {
+#if defined(__unix__) || defined(__APPLE__)
+            sockaddr_un address{};
+            if(path.size() < sizeof(address.sun_path)) {
+                address.sun_family = AF_UNIX;
+                std::memcpy(address.sun_path, path.c_str(), path.size() + 1);
+                fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+                if(fd >= 0 && ::connect(fd, reinterpret_cast<sockaddr *>(&address), sizeof(address)) != 0) {
+                    ::close(fd);
+                    fd = -1;
+                }
+            }
+            if(fd >= 0) {
+                ownsFd = true;
+                ::fcntl(fd, F_SETFL, ::fcntl(fd, F_GETFL) | O_NONBLOCK);
+#if defined(SO_NOSIGPIPE)
+                int on = 1;
+                ::setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+#endif
+            }
+#endif
         }
 
-
-    };
-
-    /**
-     *  @brief A class that can hold multiple tests of one type
-     *
-     *  @tparam T The type of the data that you are testing the value for
-     *  @tparam U the type of the data that you are comparing against for a truth value
-     *  */
-    template<class T, class U>
-    class TestType : public VectorTest<U> {
-    private:
-        std::vector<T> actualData;
-    public:
+        EventPublisher(const EventPublisher &) = delete;
+        EventPublisher &operator=(const EventPublisher &) = delete;
 
         /**
-         *
-         * @param aData Actual Data
-         * @param eData Expected Data
+         * @brief Sends what is buffered and closes the socket if the publisher opened it
          */
-        explicit TestType(std::vector<T> aData = {}, std::vector<U> eData = {}, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actualData(aData), VectorTest<U>(eData, Message, Messages, group) {}
-
-        ~TestType() = default;
+        ~EventPublisher() {
+            Stop();
+#if defined(__unix__) || defined(__APPLE__)
+            if(ownsFd) {
+                ::close(fd);
+            }
+#endif
+        }
 
         /**
-         * @brief Adds a new test to the end of the vector
-         * @param data Actual data
-         * @param expected Expected data
+         * @brief Starts the thread that sends the events, nothing is buffered before
          */
-        void Add(T data, U expected, std::string Message = "") {
-            actualData.push_back(data);
-            this->expected.push_back(expected);
-            this->messages.push_back(Message);
+        void Start() {
+            if(fd < 0 || running.exchange(true)) {
+                return;
+            }
+            writer = std::thread([this] { Write(); });
         }
 
         /**
-         * @brief Removes the last most test
+         * @brief Sends the events that are still buffered and stops the thread
          */
-        void Remove() {
-            if (!actualData.empty() && !this->expected.empty()) {
-                actualData.pop_back();
-                this->expected.pop_back();
-                if(!this->messages.empty()) {
-                    this->messages.pop_back();
-                }
+        void Stop() {
+            if(!running.exchange(false)) {
+                return;
             }
+            wake.notify_one();
+            writer.join();
+        }
+
+        bool Connected() const {
+            return fd >= 0;
         }
 
         /**
-         * @brief Run test at index i
-         * @param i The index to run at
-         * @return The state of the test
+         * @brief How many events were dropped and how many were encoded so far
          */
-        bool RunAt(int i) {
-            if (i >= actualData.size() || i >= this->expected.size()) {
-                return false;
+        std::uint64_t Dropped() const {
+            return totalDropped.load(std::memory_order_relaxed);
+        }
+        std::uint64_t Sent() const {
+            return sent.load(std::memory_order_relaxed);
+        }
+
+        void Started(int group, int test) {
+            if(running.load(std::memory_order_relaxed)) {
+                Push({Kind::Started, group, test, false, 0, 0, 0, {}});
             }
-            T actual = actualData.at(i);
-            return actualData.at(i) == this->expected.at(i);
         }
 
         /**
-         * @brief Runs all of the tests
-         * @return A vector of the results
+         * @brief Publishes a finished test, the message is only sent for failed tests
          */
-        std::vector<Result> RunAll(const std::string& message = "") {
-            std::vector<Result> results;
-            for (int i = 0; i < actualData.size(); i++) {
-                try {
-                    bool state = RunAt(i);
-                    results.emplace_back(this->message + " " + std::string(state ? "Success" : "Failure") + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
-                }
-                catch (std::exception &exception) {
-                    results.emplace_back(message + " " + std::string("Exception thrown: ") + exception.what() + ", " + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), false, this->groupNum, i + 1);
-                }
+        void Finished(int group, int test, bool state, const std::string &message) {
+            if(running.load(std::memory_order_relaxed)) {
+                Push({Kind::Finished, group, test, state, 0, 0, 0, state ? std::string() : message});
+            }
+        }
+
+        void Summary(int group, std::uint64_t passed, std::uint64_t failed) {
+            if(running.load(std::memory_order_relaxed)) {
+                Push({Kind::Summary, group, 0, false, passed, failed, 0, {}});
             }
-            return results;
         }
     };
 
     /**
-     * @brief Test a function where the nth element in the actual vector is used as the 1st argument
-     * @tparam T Type for actual
-     * @tparam U Type for expected
+     *  @brief A class that is the parent of all Tests except Tester
      *
-     * Tests a function where the nth element in the actual vector is used as the 1st argument for the
-     * method that is passed through on the RunAll function call. Additional arguments may be passed in as well.
-     * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
-     * check only for exceptions.
-     */
+     *  @tparam T The type of the data that you are testing the value for
+     *  @tparam U the type of the data that you are comparing against for a truth value
+     *  */
     template<class T, class U>
-    class TestTwoVector : public VectorTest<U> {
-    private:
-        std::vector<T> actual;
-    public:
-        TestTwoVector(std::vector<T> Actual, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actual(Actual), VectorTest<U>(Expected, Message, Messages, group) {}
+    class Test {
+    protected:
+        T data;
+        U expected;
+        std::string message;
+        int groupNum;
+    public:
+        Test(T Data, T Expected, std::string Message, int group = 0) {
+            data = Data;
+            expected = Expected;
+            message = std::move(Message);
+            groupNum = group;
+        }
+        ~Test() = default;
 
-        explicit TestTwoVector(std::vector<T> Actual, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actual(Actual), VectorTest<U>(Message, Messages, group) {}
+        virtual Result Run() {
+            return {"", false};
+        }
+    };
 
-        void UpdateTest(std::vector<T> Actual, std::vector<U> Expected, std::string Message = "") {
-            actual = Actual;
+
+    /**
+     *  @brief A class that can return floating point comparison with a range for imprecision.
+     *  @class Inherits from TesterLib::Test
+     *
+     *  @tparam T The type of the data that you are testing the value for, expected to be either **float** or **double**
+     *  @tparam U the type of the data that you are comparing against for a truth value, expected to be either **float** or **double**
+     *  */
+    template<class T, class U>
+    class TestFloat : public Test<T, U> {
+    private:
+        double upperLimit = 0;
+        double lowerLimit = 0;
+    public:
+
+        /**
+         * @brief Range constructor where upperLimit and lowerLimit are range away from 0
+         * @param data Actual data
+         * @param expected Expected data
+         * @param range Range of the limit from 0, + or -
+         */
+        TestFloat(T data, U expected, double range, std::string message = "", int group = 0) : Test<T, U>(data, expected, message, group) {
+            upperLimit = range;
+            lowerLimit = -range;
+        }
+
+        /**
+         * @brief Range constructor where upperLimit and lowerLimit are set
+         * @param data Actual data
+         * @param expected Expected data
+         * @param lLimit Lower limit
+         * @param uLimit Upper limit
+         */
+        TestFloat(T data, U expected, double lLimit, double uLimit, std::string message = "", int group = 0) : Test<T, U>(data, expected, message, group) {
+            lowerLimit = lLimit;
+            upperLimit = uLimit;
+        }
+
+        /**
+         * @brief Runs the test with lower and upper limit of leniency for floating point imprecision
+         * @return The Result of the test
+         */
+        Result Run() {
+            bool state = false;
+            std::string result;
+            try {
+                    state = (this->data + lowerLimit <= this->expected && this->data + upperLimit >= this->expected) || this->data == this->expected;
+                    result = std::string(state ? "Passed" : "Failed");
+            }
+            catch(std::exception &e) {
+                result = "Exception Thrown: " + std::string(e.what());
+            }
+            return {this->message + " " + result, state, this->groupNum, 1};
+        }
+    };
+
+
+    /**
+     * @brief A class that is the parent of all Tests that use a vector for results
+     * @tparam T The type of the expected vector
+     */
+    template<class T>
+    class VectorTest {
+    protected:
+        std::vector<Result> results;
+        std::string message; // something appended to all tests
+        std::vector<std::string> messages; // something appended to nth test
+        std::vector<T> expected;
+        int groupNum;
+        ProgressReporter *progress = nullptr;
+        EventPublisher *events = nullptr;
+        std::chrono::steady_clock::time_point started;
+
+        /**
+         * @brief Records how long the last test ran, counts it in the ProgressReporter and publishes it, if there are any
+         */
+        void Report(bool state, int index) {
+            results.back().durationNs = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count();
+            if(progress != nullptr) {
+                progress->Record(state, groupNum, index + 1);
+            }
+            if(events != nullptr) {
+                events->Finished(groupNum, index + 1, state, results.back().message);
+            }
+        }
+
+        /**
+         * @brief Starts the clock of a test, marks it as running for the CrashHandler and publishes it
+         */
+        void Begin(int index) {
+            started = std::chrono::steady_clock::now();
+            CrashHandler::Running(groupNum, index + 1, &results);
+            if(events != nullptr) {
+                events->Started(groupNum, index + 1);
+            }
+        }
+    public:
+
+        explicit VectorTest(std::vector<T> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) {
+            expected = Expected;
+            messages = std::move(Messages);
+            message = std::move(Message);
+            groupNum = group;
+        }
+
+        explicit VectorTest(std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) {
+            message = std::move(Message);
+            messages = std::move(Messages);
+            groupNum = group;
+        }
+
+        ~VectorTest() {
+            CrashHandler::Forget(&results);
+        }
+
+        /**
+         * @brief Sets the ProgressReporter that counts every finished test, nullptr for none
+         */
+        void SetProgress(ProgressReporter *reporter) {
+            progress = reporter;
+        }
+
+        /**
+         * @brief Sets the EventPublisher that every test is published to, nullptr for none
+         */
+        void SetEvents(EventPublisher *publisher) {
+            events = publisher;
+        }
+    };
+
+    /**
+      *  @brief A class that can return a list of Results that input a range of integers into a function as a first parameter
+      *  Range is inclusive
+      *
+      *  @tparam U The return type that the function/lambda will return
+      *  */
+    template<class U>
+    class TestRange : public VectorTest<U> {
+    private:
+        int from;
+        int to;
+    public:
+        /**
+         * @brief No expected constructor
+         * @param From the integer to start the range from
+         * @param To the integer to end the range to
+         * @param Message optional message that will print for every result
+         * @param Messages optional message that will print for nth result
+         */
+        TestRange(int From, int To, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : from(From), to(To), VectorTest<U>(Message, Messages, group) {}
+
+        /**
+         * @brief Expected constructor
+         * @param From the integer to start the range from
+         * @param To the integer to end the range to
+         * @param Expected an std::vector<U> that has the list of expected values for each test, in order
+         * @param Message optional message that will print for every result
+         * @param Messages optional message that will print for nth result
+         */
+        TestRange(int From, int To, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : from(From), to(To), VectorTest<U>(Expected, Message, Messages, group) {}
+
+        ~TestRange() = default;
+
+        /**
+         * @brief Update the test
+         * @param From the integer to start the range from
+         * @param To the integer to end the range to
+         * @param Message optional message that will print for every result
+         * @param Messages optional messages that will print for nth result
+         */
+        void UpdateTest(int From, int To, std::string Message = "", std::vector<std::string> Messages = {}) {
+            from = From;
+            to = To;
+            this->message = std::move(Message);
+            this->messages = std::move(Messages);
+        }
+
+        /**
+         * @brief Update the test
+         * @param From the integer to start the range from
+         * @param To the integer to end the range to
+         * @param Expected an std::vector<U> that has the list of expected values for each test, in order
+         * @param Message optional message that will print for every result
+         * @param Messages optional messages that will print for nth result
+         */
+        void UpdateTest(int From, int To, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}) {
+            from = From;
+            to = To;
+            this->message = std::move(Message);
             this->expected = Expected;
-            this->message = Message;
+            this->messages = std::move(Messages);
         }
 
         /**
-          * @brief Run all of the tests
-          * @param method A callable function, lambda or method
-          * @param args The list of extra arguments to be passed onto the Callable
-          * @return A vector of Result with the results
-          *
-          * Tests a function where the nth element in the actual vector is used as the 1st argument for the
-          * method that is passed through on the RunAll function call. Additional arguments may be passed in as well.
-          * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
-          * check only for exceptions.
-          *
-          */
+         * @brief Run all of the tests
+         * @param method A callable function, lambda or method
+         * @param args The list of arguments to be passed onto the Callable
+         * @return A vector of Result with the results
+         *
+         * This will run through all of the tests from `from` and to `to`, inclusive.
+         * It will input the current value of the range as the first parameter into the function.
+         * This MUST be the first parameter of the function or else it WILL throw a template error
+         * All other arguments will then be passed through.
+         * If supplied, it will check against the expected vector.
+         *
+         */
         template<typename Callable, typename... Args>
         std::vector<Result> RunAllArgs(Callable& method, Args... args) {
-            for(int i = 0; i < actual.size(); i++) {
+            int index = 0;
+            for(int i = from; i <= to; i++) {
+                this->Begin(index);
                 bool state = false;
                 std::string result;
                 try {
                     if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
-                        std::invoke(method, actual.at(i), args...);
+                        std::invoke(method, i, args...);
                         result = std::string("Passed: ") + std::to_string(i);
                     }
                     else {
-                        state = std::invoke(method, actual.at(i), args...) == this->expected.at(std::min<unsigned long long int>(this->expected.size() - 1, i));
+                        // if expected is smaller than range, we just use the last value as expected
+                        state = std::invoke(method, i, args...) == this->expected.at(std::min<unsigned long long>(this->expected.size() - 1, index));
                         result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
                     }
                 }
                 catch(std::exception &e) {
                     result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
                 }
-                this->results.emplace_back(this->message + " " + result + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
+                this->results.emplace_back(this->message + " " + result + (index < this->messages.size() ? ", " + this->messages.at(index) : ""), state, this->groupNum, index + 1);
+                this->Report(state, index);
+                index++;
             }
+            return this->results;
+        }
+
+        // we have the exact same function here except due to template issues, this one does not have args.
+        // this **will** throw a compile time error if it is used with a function
+        /**
+         * @brief Run all of the tests
+         * @param method A callable function, lambda or method
+         * @return A vector of Result with the results
+         *
+         * This will run through all of the tests from `from` and to `to`, inclusive.
+         * It will input the current value of the range as the first parameter into the function.
+         * This is designed for functions that specifically take in *1* parameter of type int
+         * If supplied, it will check against the expected vector.
+         *
+         */
+        template<typename Callable>
+        std::vector<Result> RunAllNoArgs(Callable& method) {
+            int index = 0;
+            for(int i = from; i <= to; i++) {
+                this->Begin(index);
+                bool state = false;
+                std::string result;
+                try {
+                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
+                        std::invoke(method, i);
+                        result = std::string("Passed: ") + std::to_string(i);
+                    }
+                    else {
+                        // if expected is smaller than range, we just use the last value as expected
+                         state = std::invoke(method, i) == this->expected.at(std::min<unsigned long long>(this->expected.size() - 1, index));
+                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
+                    }
+                }
+                catch(std::exception &e) {
+                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
+                }
+                this->results.emplace_back(this->message + " " + result + (index < this->messages.size() ? ", " + this->messages.at(index) : ""), state, this->groupNum, index + 1);
+                this->Report(state, index);
+                index++;
+            }
+            return this->results;
+        }
+
+        /**
+         * @brief Run all of the tests
+         * @param method A callable function, lambda or method
+         * @param args The list of arguments to be passed onto the Callable
+         * @return A vector of Result with the results
+         *
+         * This will run through all of the tests from `from` and to `to`, inclusive.
+         * It will input the current value of the range as the first parameter into the function.
+         * This MUST be the first parameter of the function or else it WILL throw a template error
+         * All other arguments will then be passed through.
+         * If supplied, it will check against the expected vector.
+         *
+         */
+        template<typename Callable, typename... Args>
+        std::vector<Result> RunAll(Callable& method, Args... args) {
+            return RunAllArgs(method, args...);
+        }
+
+        /**
+         * @brief Run all of the tests
+         * @param method A callable function, lambda or method
+         * @return A vector of Result with the results
+         *
+         * This will run through all of the tests from `from` and to `to`, inclusive.
+         * It will input the current value of the range as the first parameter into the function.
+         * This is designed for functions that specifically take in *1* parameter of type int
+         * If supplied, it will check against the expected vector.
+         *
+         */
+        template<typename Callable>
+        std::vector<Result> RunAll(Callable& method) {
+            return RunAllNoArgs( method); // use 0 as default argument, but won't be used
+        }
+
+
+    };
+
+    /**
+     *  @brief A class that can hold multiple tests of one type
+     *
+     *  @tparam T The type of the data that you are testing the value for
+     *  @tparam U the type of the data that you are comparing against for a truth value
+     *  */
+    template<class T, class U>
+    class TestType : public VectorTest<U> {
+    private:
+        std::vector<T> actualData;
+    public:
+
+        /**
+         *
+         * @param aData Actual Data
+         * @param eData Expected Data
+         */
+        explicit TestType(std::vector<T> aData = {}, std::vector<U> eData = {}, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actualData(aData), VectorTest<U>(eData, Message, Messages, group) {}
+
+        ~TestType() = default;
+
+        /**
+         * @brief Adds a new test to the end of the vector
+         * @param data Actual data
+         * @param expected Expected data
+         */
+        void Add(T data, U expected, std::string Message = "") {
+            actualData.push_back(data);
+            this->expected.push_back(expected);
+            this->messages.push_back(Message);
+        }
+
+        /**
+         * @brief Removes the last most test
+         */
+        void Remove() {
+            if (!actualData.empty() && !this->expected.empty()) {
+                actualData.pop_back();
+                this->expected.pop_back();
+                if(!this->messages.empty()) {
+                    this->messages.pop_back();
+                }
+            }
+        }
+
+        /**
+         * @brief Run test at index i
+         * @param i The index to run at
+         * @return The state of the test
+         */
+        bool RunAt(int i) {
+            if (i >= actualData.size() || i >= this->expected.size()) {
+                return false;
+            }
+            T actual = actualData.at(i);
+            return actualData.at(i) == this->expected.at(i);
+        }
+
+        /**
+         * @brief Runs all of the tests
+         * @return A vector of the results
+         */
+        std::vector<Result> RunAll(const std::string& message = "") {
+            std::vector<Result> results;
+            for (int i = 0; i < actualData.size(); i++) {
+                try {
+                    bool state = RunAt(i);
+                    results.emplace_back(this->message + " " + std::string(state ? "Success" : "Failure") + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
+                }
+                catch (std::exception &exception) {
+                    results.emplace_back(message + " " + std::string("Exception thrown: ") + exception.what() + ", " + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), false, this->groupNum, i + 1);
+                }
+            }
+            return results;
+        }
+    };
+
+    /**
+     * @brief Test a function where the nth element in the actual vector is used as the 1st argument
+     * @tparam T Type for actual
+     * @tparam U Type for expected
+     *
+     * Tests a function where the nth element in the actual vector is used as the 1st argument for the
+     * method that is passed through on the RunAll function call. Additional arguments may be passed in as well.
+     * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
+     * check only for exceptions.
+     */
+    template<class T, class U>
+    class TestTwoVector : public VectorTest<U> {
+    private:
+        std::vector<T> actual;
+    public:
+        TestTwoVector(std::vector<T> Actual, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actual(Actual), VectorTest<U>(Expected, Message, Messages, group) {}
+
+        explicit TestTwoVector(std::vector<T> Actual, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0) : actual(Actual), VectorTest<U>(Message, Messages, group) {}
+
+        void UpdateTest(std::vector<T> Actual, std::vector<U> Expected, std::string Message = "") {
+            actual = Actual;
+            this->expected = Expected;
+            this->message = Message;
+        }
+
+        /**
+          * @brief Run all of the tests
+          * @param method A callable function, lambda or method
+          * @param args The list of extra arguments to be passed onto the Callable
+          * @return A vector of Result with the results
+          *
+          * Tests a function where the nth element in the actual vector is used as the 1st argument for the
+          * method that is passed through on the RunAll function call. Additional arguments may be passed in as well.
+          * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
+          * check only for exceptions.
+          *
+          */
+        template<typename Callable, typename... Args>
+        std::vector<Result> RunAllArgs(Callable& method, Args... args) {
+            for(int i = 0; i < actual.size(); i++) {
+                this->Begin(i);
+                bool state = false;
+                std::string result;
+                try {
+                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
+                        std::invoke(method, actual.at(i), args...);
+                        result = std::string("Passed: ") + std::to_string(i);
+                    }
+                    else {
+                        state = std::invoke(method, actual.at(i), args...) == this->expected.at(std::min<unsigned long long int>(this->expected.size() - 1, i));
+                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
+                    }
+                }
+                catch(std::exception &e) {
+                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
+                }
+                this->results.emplace_back(this->message + " " + result + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
+                this->Report(state, i);
+            }
+
+            return this->results;
+        }
+
+        /**
+          * @brief Run all of the tests
+          * @param method A callable function, lambda or method
+          * @return A vector of Result with the results
+          *
+          * Tests a function where the nth element in the actual vector is used as the 1st argument for the
+          * method that is passed through on the RunAll function call.
+          * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
+          * check only for exceptions.
+          *
+          */
+        template<typename Callable>
+        std::vector<Result> RunAllNoArgs(Callable& method) {
+            for(int i = 0; i < actual.size(); i++) {
+                this->Begin(i);
+                bool state = false;
+                std::string result;
+                try {
+                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
+                        std::invoke(method, actual[i]);
+                        result = std::string("Passed: ") + std::to_string(i);
+                    }
+                    else {
+                        state = std::invoke(method, actual[i]) == this->expected.at(std::min<unsigned long long int>(this->expected.size() - 1, i));
+                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
+                    }
+                }
+                catch(std::exception &e) {
+                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
+                }
+                this->results.emplace_back(this->message + " " + result + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
+                this->Report(state, i);
+            }
+
+            return this->results;
+        }
+
+        template<typename Callable, typename... Args>
+        std::vector<Result> RunAll(Callable& method, Args... args) {
+            return RunAllArgs(method, args...);
+        }
+
+        template<typename Callable, typename... Args>
+        std::vector<Result> RunAll(Callable& method) {
+            return RunAllNoArgs(method);
+        }
+
+
+    };
+
+    /**
+     * @brief Keeps the compiler from optimizing away a value that is otherwise unused
+     * @tparam T Type of the value
+     * @param value The value that has to be computed
+     */
+    template<typename T>
+    inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static volatile const void *sink;
+        sink = &value;
+#endif
+    }
+
+    /**
+     * @brief How TestTiming treats the caches between timed iterations
+     */
+    enum class CacheMode {
+        Hot,   // nothing is evicted, every iteration runs against the caches the previous one warmed up
+        Sweep, // a buffer larger than the last level cache is swept before every iteration
+        Flush  // the cache lines of the inputs are flushed before every iteration (a Sweep where that is not possible)
+    };
+
+    /**
+     * @brief Evicts data from the CPU caches, either all of it or only the lines of one object
+     *
+     * Sweep walks a buffer of twice the last level cache size and writes to every line, which pushes out
+     * everything else (dirty lines included). FlushLines uses clflush (or dc civac on ARM) to evict only the
+     * given memory, which is much cheaper when the working set of a test is known.
+     */
+    class CacheFlusher {
+    private:
+        std::vector<unsigned char> buffer;
+        std::size_t bufferSize;
+        std::size_t lineSize = 64;
+    public:
+        /**
+         * @brief Constructor
+         * @param bytes The size of the sweep buffer, 0 to pick twice the size of the last level cache
+         */
+        explicit CacheFlusher(std::size_t bytes = 0) {
+            std::size_t cacheSize = 0;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+            long level3 = sysconf(_SC_LEVEL3_CACHE_SIZE);
+            long level2 = sysconf(_SC_LEVEL2_CACHE_SIZE);
+            long line = sysconf(_SC_LEVEL1_DCACHE_LINESIZE);
+            cacheSize = static_cast<std::size_t>(std::max(level3, level2) > 0 ? std::max(level3, level2) : 0);
+            if(line > 0) {
+                lineSize = static_cast<std::size_t>(line);
+            }
+#endif
+            // some systems report no cache sizes at all, 32 MiB covers the last level cache of most desktop parts
+            bufferSize = bytes != 0 ? bytes : std::max<std::size_t>(cacheSize * 2, 32 * 1024 * 1024);
+        }
+
+        /**
+         * @brief Evicts everything by writing to every cache line of a buffer bigger than the last level cache
+         *
+         * The buffer is only allocated on the first sweep, so a CacheFlusher that never sweeps costs nothing.
+         */
+        void Sweep() {
+            if(buffer.empty()) {
+                buffer.assign(bufferSize, 0);
+            }
+            unsigned char sum = 0;
+            for(std::size_t i = 0; i < buffer.size(); i += lineSize) {
+                buffer[i]++;
+                sum += buffer[i];
+            }
+            doNotOptimize(sum);
+        }
+
+        /**
+         * @brief Evicts the cache lines that hold [address, address + bytes)
+         * @param address The start of the memory to evict
+         * @param bytes The number of bytes to evict
+         *
+         * Falls back to a Sweep on architectures without a user space cache line flush.
+         */
+        void FlushLines(const void *address, std::size_t bytes) {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(__aarch64__)
+            auto start = reinterpret_cast<std::uintptr_t>(address) & ~(static_cast<std::uintptr_t>(lineSize) - 1);
+            auto end = reinterpret_cast<std::uintptr_t>(address) + bytes;
+            for(std::uintptr_t line = start; line < end; line += lineSize) {
+#if defined(__aarch64__)
+                asm volatile("dc civac, %0" : : "r"(line) : "memory");
+#else
+                _mm_clflush(reinterpret_cast<const void *>(line));
+#endif
+            }
+#if defined(__aarch64__)
+            asm volatile("dsb ish" : : : "memory");
+#else
+            _mm_mfence();
+#endif
+#else
+            (void) address;
+            (void) bytes;
+            Sweep();
+#endif
+        }
+
+        /**
+         * @brief Evicts a value, and the elements it holds if it is a contiguous container (std::vector, std::string, ...)
+         * @tparam T Type of the value
+         * @param value The value to evict
+         */
+        template<typename T>
+        void Flush(const T &value) {
+            FlushLines(&value, sizeof(T));
+            if constexpr (std::ranges::contiguous_range<const T> && std::ranges::sized_range<const T>) {
+                FlushLines(std::ranges::data(value), std::ranges::size(value) * sizeof(std::ranges::range_value_t<const T>));
+            }
+        }
+    };
+
+    /**
+     * @brief Which clock TestTiming reads
+     */
+    enum class TimerBackend {
+        SteadyClock, // std::chrono::steady_clock
+        Tsc          // serialized rdtsc/rdtscp reads, clock_gettime where the TSC cannot be trusted
+    };
+
+    /**
+     * @brief What a timing test does when the CPU frequency governor is not "performance"
+     */
+    enum class GovernorPolicy {
+        Ignore, // time anyway
+        Warn,   // time anyway, but warn on std::cerr and note it in the result
+        Refuse  // do not time, the result fails
+    };
+
+    /**
+     * @brief Options for timing tests, see Tester::setTimingOptions
+     *  All fields are public for easy debugging
+     */
+    class TimingOptions {
+    public:
+        TimerBackend backend = TimerBackend::SteadyClock;
+        std::vector<int> cpus;                           // CPUs the timing thread is pinned to, empty to leave it alone
+        std::vector<int> workerCpus;                     // CPUs the testThroughput workers are pinned to, round robin
+        GovernorPolicy governorPolicy = GovernorPolicy::Ignore;
+        int rounds = 1;                                  // repetitions of the whole measurement, compared to spot noise
+        double maxVariation = 0;                         // fail if the round medians differ by more than this (0.05 = 5%), 0 to never fail
+    };
+
+    /**
+     * @brief Options for finding performance cliffs in testRange sweeps, see Tester::setCliffOptions
+     *
+     * When enabled, testRange times its Callable at points spread over the range after checking the results, and
+     * looks for sudden jumps in the time per element, such as the ones at cache size boundaries, rehashes or
+     * allocation size classes.
+     */
+    class CliffOptions {
+    public:
+        bool enabled = false;
+        std::size_t points = 64;                         // indexes to time, spread geometrically over the range, 0 for every index
+        std::chrono::nanoseconds minTime = std::chrono::microseconds(200); // the least time of one timed round, the call is repeated to reach it
+        int rounds = 5;                                  // timed rounds per index, the median is used
+        double threshold = 1.5;                          // a rise of the per element time by this factor is a cliff
+        int window = 2;                                  // how many points before and after a cliff are compared
+        bool perElement = true;                          // divide the time by the index, for sweeps where the index is the size
+    };
+
+    /**
+     * @brief A start/stop timer that reports nanoseconds with its own overhead taken out
+     *
+     * The Tsc backend reads the time stamp counter with lfence/rdtsc at the start and rdtscp/lfence at the end, so
+     * that the timed code cannot be reordered around the reads. The counter frequency is calibrated once per
+     * process against CLOCK_MONOTONIC_RAW. The TSC is only used if the CPU reports it as invariant (constant rate
+     * through frequency changes and sleep states) and the calibration is consistent, otherwise clock_gettime is used.
+     */
+    class Timer {
+    private:
+        enum class Source { Steady, Monotonic, Tsc };
+
+        struct TscCalibration {
+            bool reliable = false;
+            double nsPerTick = 1;
+        };
+
+        Source source = Source::Steady;
+        double nsPerTick = 1;
+        double overheadNs = 0;
+
+        static std::uint64_t MonotonicNs() {
+#if defined(__unix__) || defined(__APPLE__)
+            timespec now{};
+#if defined(CLOCK_MONOTONIC_RAW)
+            clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+#else
+            clock_gettime(CLOCK_MONOTONIC, &now);
+#endif
+            return static_cast<std::uint64_t>(now.tv_sec) * 1000000000ull + static_cast<std::uint64_t>(now.tv_nsec);
+#else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+#endif
+        }
+
+        static const TscCalibration &Calibration() {
+            static const TscCalibration calibration = [] {
+                TscCalibration result;
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+                unsigned int eax = 0, ebx = 0, ecx = 0, edx = 0;
+                if(!__get_cpuid(0x80000001, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 27))) { // rdtscp
+                    return result;
+                }
+                if(!__get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) || !(edx & (1u << 8))) { // invariant TSC
+                    return result;
+                }
+                std::vector<double> trials;
+                for(int trial = 0; trial < 3; trial++) {
+                    std::uint64_t startNs = MonotonicNs();
+                    std::uint64_t startTicks = __rdtsc();
+                    std::uint64_t endNs = startNs;
+                    while(endNs - startNs < 10000000) { // 10ms per trial
+                        endNs = MonotonicNs();
+                    }
+                    std::uint64_t endTicks = __rdtsc();
+                    if(endTicks <= startTicks) {
+                        return result;
+                    }
+                    trials.push_back(static_cast<double>(endNs - startNs) / static_cast<double>(endTicks - startTicks));
+                }
+                std::sort(trials.begin(), trials.end());
+                // a counter between 0.2 and 10 GHz whose trials agree within 1% is one we can trust
+                result.nsPerTick = trials[1];
+                result.reliable = trials[1] > 0.1 && trials[1] < 5 && (trials[2] - trials[0]) / trials[1] < 0.01;
+#endif
+                return result;
+            }();
+            return calibration;
+        }
+
+        std::uint64_t Read(bool end) const {
+            switch(source) {
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+                case Source::Tsc: {
+                    if(end) {
+                        unsigned int aux = 0;
+                        std::uint64_t ticks = __rdtscp(&aux);
+                        _mm_lfence();
+                        return ticks;
+                    }
+                    _mm_lfence();
+                    std::uint64_t ticks = __rdtsc();
+                    _mm_lfence();
+                    return ticks;
+                }
+#endif
+                case Source::Monotonic:
+                    return MonotonicNs();
+                default:
+                    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count());
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructor, picks the clock and measures the overhead of a start/stop pair
+         * @param backend The requested backend, Tsc falls back to clock_gettime if the TSC is not reliable
+         */
+        explicit Timer(TimerBackend backend = TimerBackend::SteadyClock) {
+            if(backend == TimerBackend::Tsc) {
+                const TscCalibration &calibration = Calibration();
+                source = calibration.reliable ? Source::Tsc : Source::Monotonic;
+                nsPerTick = calibration.reliable ? calibration.nsPerTick : 1;
+            }
+            double smallest = std::numeric_limits<double>::max();
+            for(int i = 0; i < 1000; i++) {
+                std::uint64_t start = Start();
+                std::uint64_t stop = Stop();
+                smallest = std::min(smallest, static_cast<double>(stop - start) * nsPerTick);
+            }
+            overheadNs = smallest;
+        }
+
+        std::uint64_t Start() const {
+            return Read(false);
+        }
+
+        std::uint64_t Stop() const {
+            return Read(true);
+        }
+
+        /**
+         * @brief Nanoseconds between a Start and a Stop, minus the measured timer overhead
+         */
+        double Elapsed(std::uint64_t start, std::uint64_t stop) const {
+            return std::max(0.0, static_cast<double>(stop - start) * nsPerTick - overheadNs);
+        }
+
+        /**
+         * @brief A description of the clock in use, e.g. "tsc 2.90 GHz, overhead 6.9 ns"
+         */
+        std::string Name() const {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(2);
+            switch(source) {
+                case Source::Tsc: out << "tsc " << 1 / nsPerTick << " GHz"; break;
+                case Source::Monotonic: out << "clock_gettime"; break;
+                default: out << "steady_clock"; break;
+            }
+            out << std::setprecision(1) << ", overhead " << overheadNs << " ns";
+            return out.str();
+        }
+    };
+
+    /**
+     * @brief Pins the calling thread to a set of CPUs until it goes out of scope
+     *
+     * An empty set of CPUs leaves the affinity alone. Pinning is only supported on Linux, elsewhere Pinned() is false.
+     */
+    class AffinityGuard {
+    private:
+#if defined(__linux__)
+        cpu_set_t previous{};
+#endif
+        bool pinned = false;
+    public:
+        explicit AffinityGuard(const std::vector<int> &cpus) {
+#if defined(__linux__)
+            if(cpus.empty()) {
+                return;
+            }
+            cpu_set_t wanted;
+            CPU_ZERO(&wanted);
+            for(int cpu : cpus) {
+                if(cpu >= 0 && cpu < CPU_SETSIZE) {
+                    CPU_SET(cpu, &wanted);
+                }
+            }
+            pinned = pthread_getaffinity_np(pthread_self(), sizeof(previous), &previous) == 0
+                     && pthread_setaffinity_np(pthread_self(), sizeof(wanted), &wanted) == 0;
+#else
+            (void) cpus;
+#endif
+        }
+
+        ~AffinityGuard() {
+#if defined(__linux__)
+            if(pinned) {
+                pthread_setaffinity_np(pthread_self(), sizeof(previous), &previous);
+            }
+#endif
+        }
+
+        AffinityGuard(const AffinityGuard &) = delete;
+        AffinityGuard &operator=(const AffinityGuard &) = delete;
+
+        bool Pinned() const {
+            return pinned;
+        }
+    };
+
+    /**
+     * @brief The machine state a measurement was taken in
+     *  All fields are public for easy debugging
+     *
+     * Fields that cannot be read on this platform are "unknown", governor is empty when there is no cpufreq driver.
+     */
+    class TimingEnvironment {
+    public:
+        std::string cpuModel = "unknown";
+        std::string governor;
+        std::string smt = "unknown";
+        std::vector<int> affinity;
+
+        /**
+         * @brief Reads the environment of the calling thread
+         * @return The TimingEnvironment, with the governor of every CPU in the affinity joined by '/'
+         */
+        static TimingEnvironment Capture() {
+            TimingEnvironment environment;
+#if defined(__linux__)
+            std::ifstream cpuinfo("/proc/cpuinfo");
+            std::string line;
+            while(std::getline(cpuinfo, line)) {
+                if(line.rfind("model name", 0) == 0 && line.find(':') != std::string::npos) {
+                    environment.cpuModel = line.substr(line.find(':') + 2);
+                    break;
+                }
+            }
+            cpu_set_t set;
+            CPU_ZERO(&set);
+            if(sched_getaffinity(0, sizeof(set), &set) == 0) {
+                for(int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+                    if(CPU_ISSET(cpu, &set)) {
+                        environment.affinity.push_back(cpu);
+                    }
+                }
+            }
+            std::vector<std::string> governors;
+            for(int cpu : environment.affinity) {
+                std::string governor = ReadFirstLine("/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/cpufreq/scaling_governor");
+                if(!governor.empty() && std::find(governors.begin(), governors.end(), governor) == governors.end()) {
+                    governors.push_back(governor);
+                }
+            }
+            for(const std::string &governor : governors) {
+                environment.governor += (environment.governor.empty() ? "" : "/") + governor;
+            }
+            std::string smtActive = ReadFirstLine("/sys/devices/system/cpu/smt/active");
+            if(!smtActive.empty()) {
+                environment.smt = smtActive == "1" ? "on" : "off";
+            }
+#endif
+            return environment;
+        }
+
+        static std::string ReadFirstLine(const std::string &path) {
+            std::ifstream file(path);
+            std::string line;
+            std::getline(file, line);
+            return line;
+        }
+
+        std::string toString() const {
+            std::string cpus;
+            for(std::size_t i = 0; i < affinity.size(); i++) { // print runs of CPUs as ranges, "0-3,8"
+                std::size_t j = i;
+                while(j + 1 < affinity.size() && affinity[j + 1] == affinity[j] + 1) {
+                    j++;
+                }
+                cpus += (cpus.empty() ? "" : ",") + std::to_string(affinity[i]) + (j > i ? "-" + std::to_string(affinity[j]) : "");
+                i = j;
+            }
+            return "CPU: " + cpuModel + ", governor: " + (governor.empty() ? "unknown" : governor) + ", SMT: " + smt
+                   + ", affinity: " + (cpus.empty() ? "unknown" : cpus);
+        }
+    };
+
+    /**
+     * @brief Timing summary of a TestTiming run
+     *  All fields are public for easy debugging
+     */
+    class TimingStats {
+    public:
+        std::string label;
+        int groupNum = 0;
+        unsigned long long iterations = 0;
+        double minNs = 0;
+        double medianNs = 0;
+        double meanNs = 0;
+        double maxNs = 0;
+        int rounds = 1;
+        double variation = 0; // (slowest - fastest) / fastest median of the rounds
+        double opsPerSecond = 0; // only set by throughput tests
+        TimingEnvironment environment;
+
+        TimingStats() = default;
+
+        /**
+         * @brief Builds the summary out of the per iteration times
+         * @param Label What was measured, e.g. the cache mode
+         * @param samples Time of each iteration in nanoseconds
+         * @param group The group number of the test
+         */
+        TimingStats(std::string Label, std::vector<double> samples, int group = 0) : label(std::move(Label)), groupNum(group) {
+            iterations = samples.size();
+            if(samples.empty()) {
+                return;
+            }
+            std::sort(samples.begin(), samples.end());
+            minNs = samples.front();
+            maxNs = samples.back();
+            medianNs = samples.size() % 2 == 1 ? samples[samples.size() / 2] : (samples[samples.size() / 2 - 1] + samples[samples.size() / 2]) / 2;
+            meanNs = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+        }
+
+        std::string toString() const {
+            std::ostringstream out;
+            out << std::fixed << std::setprecision(1) << label << ", " << iterations << " iterations, min " << minNs
+                << " ns, median " << medianNs << " ns, mean " << meanNs << " ns, max " << maxNs << " ns";
+            if(rounds > 1) {
+                out << ", variation " << variation * 100 << "% over " << rounds << " rounds";
+            }
+            if(opsPerSecond > 0) {
+                out << ", " << opsPerSecond << " calls/s";
+            }
+            return out.str();
+        }
+    };
+
+    /**
+     * @brief A class that times a callable, optionally with cold caches or rotating inputs
+     *
+     * Timing the same call on the same input over and over trains the caches and the branch predictors, so the
+     * numbers end up better than anything production will see. CacheMode evicts the caches before every
+     * iteration (outside of the timed region), and RunInputs walks a shuffled pool of inputs so that no
+     * single input can be learned by the branch predictor.
+     *
+     * Every run is pinned to TimingOptions::cpus, checked against TimingOptions::governorPolicy and records the
+     * TimingEnvironment it ran in. With more than one round, the medians of the rounds are compared and the result
+     * fails if they vary more than TimingOptions::maxVariation, which is what a noisy neighbour looks like.
+     */
+    class TestTiming {
+    private:
+        int iterations;
+        CacheMode mode;
+        std::string message;
+        int groupNum;
+        TimingOptions options;
+        CacheFlusher flusher;
+        Timer timer;
+        TimingStats stats;
+
+        template<typename... Inputs>
+        void Evict(const Inputs &... inputs) {
+            if(mode == CacheMode::Sweep) {
+                flusher.Sweep();
+            }
+            else if(mode == CacheMode::Flush) {
+                (flusher.Flush(inputs), ...);
+            }
+        }
+
+        template<typename Callable, typename... Args>
+        void Call(Callable &method, Args &... args) {
+            if constexpr (std::is_void_v<std::invoke_result_t<Callable &, Args &...>>) {
+                std::invoke(method, args...);
+            }
+            else {
+                doNotOptimize(std::invoke(method, args...));
+            }
+        }
+
+        template<typename Callable, typename... Args>
+        double TimeOne(Callable &method, Args &... args) {
+            std::uint64_t start = timer.Start();
+            Call(method, args...);
+            std::uint64_t stop = timer.Stop();
+            return timer.Elapsed(start, stop);
+        }
+
+        static std::string ModeName(CacheMode cacheMode) {
+            switch(cacheMode) {
+                case CacheMode::Sweep: return "cold (sweep)";
+                case CacheMode::Flush: return "cold (flush)";
+                default: return "hot";
+            }
+        }
+
+        /**
+         * @brief Pins the thread, captures the environment and applies the GovernorPolicy
+         * @param pin The guard that pinned the thread to TimingOptions::cpus
+         * @param note Set to a note for the result when something is off
+         * @return false if the run has to be refused
+         */
+        bool Prepare(const AffinityGuard &pin, std::string &note) {
+            stats = TimingStats();
+            stats.groupNum = groupNum;
+            stats.environment = TimingEnvironment::Capture();
+            if(!options.cpus.empty() && !pin.Pinned()) {
+                note += " (could not pin to the requested CPUs)";
+            }
+            const std::string &governor = stats.environment.governor;
+            if(options.governorPolicy == GovernorPolicy::Ignore || governor.empty() || governor == "performance") {
+                return true;
+            }
+            if(options.governorPolicy == GovernorPolicy::Refuse) {
+                note += " Refused: frequency governor is '" + governor + "' instead of 'performance'";
+                return false;
+            }
+            std::cerr << "Warning: frequency governor is '" << governor << "', timings of group " << groupNum << " may vary" << std::endl;
+            note += " (governor " + governor + ")";
+            return true;
+        }
+
+        Result Finish(std::vector<double> &samples, const std::string &label, const std::string &note, int rounds, double variation) {
+            TimingEnvironment environment = std::move(stats.environment);
+            stats = TimingStats(label, std::move(samples), groupNum);
+            stats.environment = std::move(environment);
+            stats.rounds = rounds;
+            stats.variation = variation;
+            if(options.maxVariation > 0 && variation > options.maxVariation) {
+                std::ostringstream unstable;
+                unstable << std::fixed << std::setprecision(1) << " Unstable: run-to-run variation " << variation * 100
+                         << "% exceeds " << options.maxVariation * 100 << "%, ";
+                return {this->message + unstable.str() + stats.toString() + note, false, groupNum, 1};
+            }
+            return {this->message + " Timing: " + stats.toString() + note, true, groupNum, 1};
+        }
+
+        /**
+         * @brief Runs TimingOptions::rounds rounds of iterations samples
+         * @param label What is measured
+         * @param sample Takes one sample for iteration i of a round
+         * @param locate Describes iteration i for an exception message
+         * @return The Result of the measurement
+         */
+        template<typename Sampler, typename Locator>
+        Result Measure(const std::string &label, Sampler sample, Locator locate) {
+            if(iterations <= 0) {
+                return {this->message + " No iterations to time", false, groupNum, 1};
+            }
+            AffinityGuard pin(options.cpus);
+            std::string note;
+            if(!Prepare(pin, note)) {
+                return {this->message + note, false, groupNum, 1};
+            }
+            int rounds = std::max(1, options.rounds);
+            std::vector<double> samples;
+            samples.reserve(static_cast<std::size_t>(iterations) * rounds);
+            std::vector<double> medians;
+            int i = 0;
+            try {
+                for(int round = 0; round < rounds; round++) {
+                    for(i = 0; i < iterations; i++) {
+                        samples.push_back(sample(i));
+                    }
+                    std::vector<double> slice(samples.end() - iterations, samples.end());
+                    std::nth_element(slice.begin(), slice.begin() + slice.size() / 2, slice.end());
+                    medians.push_back(slice[slice.size() / 2]);
+                }
+            }
+            catch(std::exception &e) {
+                return {this->message + " Exception Thrown: " + std::string(e.what()) + " on " + locate(i), false, groupNum, 1};
+            }
+            auto [fastest, slowest] = std::minmax_element(medians.begin(), medians.end());
+            double variation = *fastest > 0 ? (*slowest - *fastest) / *fastest : 0;
+            return Finish(samples, label, note, rounds, variation);
+        }
+
+    public:
+        /**
+         * @brief Constructor
+         * @param Iterations How many times the callable will be timed per round
+         * @param Mode What to evict between iterations
+         * @param Message optional message that will be appended to the result
+         * @param group The group number of the test
+         * @param Options The timer, affinity, governor and variance settings
+         */
+        explicit TestTiming(int Iterations, CacheMode Mode = CacheMode::Hot, std::string Message = "", int group = 0, const TimingOptions &Options = {}) : iterations(Iterations), mode(Mode), message(std::move(Message)), groupNum(group), options(Options), timer(Options.backend) {}
+
+        ~TestTiming() = default;
+
+        /**
+         * @brief Times the callable with the same arguments on every iteration
+         * @param method A callable function, lambda or method
+         * @param args The list of arguments to be passed onto the Callable
+         * @return A Result that fails if the callable threw, the run was refused or it was unstable
+         */
+        template<typename Callable, typename... Args>
+        Result Run(Callable &method, Args... args) {
+            return Measure(ModeName(mode) + ", " + timer.Name(),
+                           [&](int) { Evict(args...); return TimeOne(method, args...); },
+                           [](int i) { return "iteration " + std::to_string(i + 1); });
+        }
+
+        /**
+         * @brief Times the callable while rotating through a pool of inputs
+         * @param inputs The inputs, each is passed as the first argument to the callable
+         * @param method A callable function, lambda or method
+         * @param args The list of extra arguments to be passed onto the Callable
+         * @return A Result that fails if the callable threw, the run was refused or it was unstable
+         *
+         * The inputs are visited in a fresh random order on every pass over the pool, the order is
+         * generated up front so that the shuffling is not timed.
+         */
+        template<typename T, typename Callable, typename... Args>
+        Result RunInputs(std::vector<T> &inputs, Callable &method, Args... args) {
+            if(inputs.empty()) {
+                return {this->message + " No inputs to time", false, groupNum, 1};
+            }
+            std::vector<std::size_t> order;
+            std::vector<std::size_t> pass(inputs.size());
+            std::iota(pass.begin(), pass.end(), 0);
+            std::mt19937 random(0x7e57u); // fixed seed so that runs are comparable
+            while(order.size() < static_cast<std::size_t>(std::max(iterations, 0))) {
+                std::shuffle(pass.begin(), pass.end(), random);
+                order.insert(order.end(), pass.begin(), pass.begin() + std::min(pass.size(), iterations - order.size()));
+            }
+            return Measure(ModeName(mode) + ", " + std::to_string(inputs.size()) + " rotating inputs, " + timer.Name(),
+                           [&](int i) { Evict(inputs[order[i]], args...); return TimeOne(method, inputs[order[i]], args...); },
+                           [&](int i) { return "input " + std::to_string(order[i]); });
+        }
+
+        /**
+         * @brief Runs the callable on several worker threads at once and measures the combined throughput
+         * @param threads The number of worker threads
+         * @param method A callable function, lambda or method, called concurrently from every worker
+         * @param args The list of arguments to be passed onto the Callable, shared by all workers
+         * @return A Result that fails if the callable threw or the run was refused
+         *
+         * Each worker makes `iterations` calls and is pinned to one CPU of TimingOptions::workerCpus (round robin);
+         * workers that could not be pinned are counted in the message. The caches are not evicted between calls. The samples are the time per call of each worker, the
+         * throughput is the total number of calls over the wall time of all workers.
+         */
+        template<typename Callable, typename... Args>
+        Result RunThroughput(int threads, Callable &method, Args... args) {
+            if(iterations <= 0 || threads <= 0) {
+                return {this->message + " No iterations to time", false, groupNum, 1};
+            }
+            AffinityGuard pin(options.cpus);
+            std::string note;
+            if(!Prepare(pin, note)) {
+                return {this->message + note, false, groupNum, 1};
+            }
+            std::atomic<int> ready = 0;
+            std::atomic<bool> go = false;
+            std::vector<double> perCall(threads);
+            std::vector<std::optional<std::string>> errors(threads);
+            std::atomic<int> unpinned = 0;
+            std::vector<std::thread> workers;
+            for(int t = 0; t < threads; t++) {
+                workers.emplace_back([&, t] {
+                    std::vector<int> cpu;
+                    if(!options.workerCpus.empty()) {
+                        cpu.push_back(options.workerCpus[t % options.workerCpus.size()]);
+                    }
+                    AffinityGuard workerPin(cpu);
+                    if(!cpu.empty() && !workerPin.Pinned()) {
+                        unpinned++;
+                    }
+                    ready++;
+                    while(!go.load(std::memory_order_acquire)) {
+                        std::this_thread::yield();
+                    }
+                    std::uint64_t start = timer.Start();
+                    try {
+                        for(int i = 0; i < iterations; i++) {
+                            Call(method, args...);
+                        }
+                    }
+                    catch(std::exception &e) {
+                        errors[t] = e.what();
+                    }
+                    catch(...) { // would otherwise end the process through std::terminate
+                        errors[t] = "unknown exception";
+                    }
+                    perCall[t] = timer.Elapsed(start, timer.Stop()) / iterations;
+                });
+            }
+            while(ready.load() < threads) {
+                std::this_thread::yield();
+            }
+            std::uint64_t start = timer.Start();
+            go.store(true, std::memory_order_release);
+            for(std::thread &worker : workers) {
+                worker.join();
+            }
+            double wallNs = timer.Elapsed(start, timer.Stop());
+            for(int t = 0; t < threads; t++) {
+                if(errors[t]) {
+                    return {this->message + " Exception Thrown: " + *errors[t] + " on worker " + std::to_string(t + 1), false, groupNum, 1};
+                }
+            }
+            if(unpinned > 0) {
+                note += " (could not pin " + std::to_string(unpinned.load()) + " of " + std::to_string(threads) + " workers to their CPUs)";
+            }
+            Result res = Finish(perCall, std::to_string(threads) + " threads, " + timer.Name(), note, 1, 0);
+            stats.iterations = static_cast<unsigned long long>(iterations) * threads;
+            stats.opsPerSecond = wallNs > 0 ? static_cast<double>(stats.iterations) / (wallNs / 1e9) : 0;
+            res.message = this->message + " Timing: " + stats.toString() + note;
+            return res;
+        }
+
+        /**
+         * @brief Get the timing summary of the last run
+         */
+        const TimingStats &GetStats() const {
+            return stats;
+        }
+    };
+
+    /**
+     * @brief A std::pmr::memory_resource that forwards to another resource and counts the calls that pass through it
+     *
+     * The counters are atomic, so a CountingResource in front of a synchronized_pool_resource can be shared by threads.
+     */
+    class CountingResource : public std::pmr::memory_resource {
+    private:
+        std::pmr::memory_resource *upstream;
+        std::atomic<unsigned long long> allocations = 0;
+        std::atomic<unsigned long long> deallocations = 0;
+        std::atomic<unsigned long long> bytes = 0;
+        std::atomic<unsigned long long> currentBytes = 0;
+        std::atomic<unsigned long long> peakBytes = 0;
+
+        void *do_allocate(std::size_t size, std::size_t alignment) override {
+            void *pointer = upstream->allocate(size, alignment);
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            bytes.fetch_add(size, std::memory_order_relaxed);
+            unsigned long long now = currentBytes.fetch_add(size, std::memory_order_relaxed) + size;
+            unsigned long long peak = peakBytes.load(std::memory_order_relaxed);
+            while(now > peak && !peakBytes.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+            return pointer;
+        }
+
+        void do_deallocate(void *pointer, std::size_t size, std::size_t alignment) override {
+            upstream->deallocate(pointer, size, alignment);
+            deallocations.fetch_add(1, std::memory_order_relaxed);
+            currentBytes.fetch_sub(size, std::memory_order_relaxed);
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override {
+            return this == &other;
+        }
+
+    public:
+        explicit CountingResource(std::pmr::memory_resource *Upstream) : upstream(Upstream) {}
+
+        unsigned long long Allocations() const { return allocations.load(); }
+        unsigned long long Deallocations() const { return deallocations.load(); }
+        unsigned long long Bytes() const { return bytes.load(); }
+        unsigned long long PeakBytes() const { return peakBytes.load(); }
+    };
+
+    /**
+     * @brief Counts the heap allocations of the whole program, through replaced global operator new and delete
+     *
+     * The replacements are only compiled in the translation unit that defines TESTER_TRACK_ALLOCATIONS before it
+     * includes tester.h, which has to be exactly one per program. Without it, Installed() is false and the tests that
+     * need the tracker fail with a message saying so. Every allocation is counted with relaxed atomics and keeps its
+     * size in a small header, so that the bytes in use and their peak are known.
+     */
+    class AllocationTracker {
+    private:
+        static inline std::atomic<long long> currentBytes = 0;
+        static inline std::atomic<long long> peakBytes = 0;
+        static inline std::atomic<unsigned long long> allocations = 0;
+        static inline std::atomic<long long> failCountdown = 0; // > 0: the allocation that brings it to 0 fails
+
+    public:
+        static inline bool installed = false;
+
+        /**
+         * @brief Whether the replaced operator new and delete are compiled in
+         */
+        static bool Installed() {
+            return installed;
+        }
+
+        static long long CurrentBytes() {
+            return currentBytes.load(std::memory_order_relaxed);
+        }
+
+        static long long PeakBytes() {
+            return peakBytes.load(std::memory_order_relaxed);
+        }
+
+        static unsigned long long Allocations() {
+            return allocations.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Starts a new peak from the bytes in use now
+         */
+        static void ResetPeak() {
+            peakBytes.store(currentBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Makes the nth allocation from now fail, 0 to stop failing
+         */
+        static void FailAt(long long n) {
+            failCountdown.store(n, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief How many allocations from now the failing one is, 0 if none is pending
+         */
+        static long long FailsIn() {
+            return std::max(0LL, failCountdown.load(std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Counts an allocation, called by the replaced operator new
+         * @return false if the allocation has to fail
+         */
+        static bool Allocate(std::size_t size) {
+            if(failCountdown.load(std::memory_order_relaxed) > 0 && failCountdown.fetch_sub(1, std::memory_order_relaxed) == 1) {
+                return false;
+            }
+            allocations.fetch_add(1, std::memory_order_relaxed);
+            long long now = currentBytes.fetch_add(static_cast<long long>(size), std::memory_order_relaxed) + static_cast<long long>(size);
+            long long peak = peakBytes.load(std::memory_order_relaxed);
+            while(now > peak && !peakBytes.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+            return true;
+        }
+
+        /**
+         * @brief Counts a deallocation, called by the replaced operator delete
+         */
+        static void Deallocate(std::size_t size) {
+            currentBytes.fetch_sub(static_cast<long long>(size), std::memory_order_relaxed);
+        }
+    };
+
+    /**
+     * @brief The growth classes testMemoryScaling fits
+     */
+    enum class Complexity {Constant, Linear, Linearithmic, Quadratic};
+
+    /**
+     * @brief The name of a Complexity, e.g. "O(n log n)"
+     */
+    inline std::string toString(Complexity complexity) {
+        switch(complexity) {
+            case Complexity::Constant:
+                return "O(1)";
+            case Complexity::Linear:
+                return "O(n)";
+            case Complexity::Linearithmic:
+                return "O(n log n)";
+            case Complexity::Quadratic:
+                return "O(n^2)";
+        }
+        return "O(?)";
+    }
+
+    /**
+     * @brief The memory resources TestMemoryResource runs a callable under
+     */
+    enum class MemoryResourceKind {
+        NewDelete,          // std::pmr::new_delete_resource()
+        Monotonic,          // std::pmr::monotonic_buffer_resource with an initial buffer, released between iterations
+        UnsynchronizedPool, // std::pmr::unsynchronized_pool_resource
+        SynchronizedPool    // std::pmr::synchronized_pool_resource
+    };
+
+    /**
+     * @brief A class that runs the same callable under several std::pmr memory resources
+     * @tparam U The return type that the function/lambda will return
+     *
+     * The callable gets a std::pmr::memory_resource* as its first argument. For every resource it is called once to
+     * check the result against expected (if supplied) and to count the allocations it makes, then it is timed. Each
+     * resource gets one Result, with its allocation counts and median time, and one TimingStats. Allocations are
+     * counted twice: the requests of the callable, and the upstream requests the resource makes to new/delete.
+     */
+    template<class U>
+    class TestMemoryResource : public VectorTest<U> {
+    private:
+        int iterations;
+        std::size_t bufferSize;
+        TimingOptions options;
+        std::vector<TimingStats> stats;
+
+        static std::string Name(MemoryResourceKind kind) {
+            switch(kind) {
+                case MemoryResourceKind::Monotonic: return "monotonic_buffer";
+                case MemoryResourceKind::UnsynchronizedPool: return "unsynchronized_pool";
+                case MemoryResourceKind::SynchronizedPool: return "synchronized_pool";
+                default: return "new_delete";
+            }
+        }
+
+        template<typename Callable, typename... Args>
+        Result RunOne(MemoryResourceKind kind, int index, Callable &method, Args &... args) {
+            // the resource under test gets its memory from upstream, which tells how often it has to go to the system
+            CountingResource upstream(std::pmr::new_delete_resource());
+            std::vector<std::byte> initial(kind == MemoryResourceKind::Monotonic ? bufferSize : 0);
+            std::optional<std::pmr::monotonic_buffer_resource> monotonic;
+            std::optional<std::pmr::unsynchronized_pool_resource> unsynchronizedPool;
+            std::optional<std::pmr::synchronized_pool_resource> synchronizedPool;
+            std::pmr::memory_resource *resource = &upstream;
+            switch(kind) {
+                case MemoryResourceKind::Monotonic: resource = &monotonic.emplace(initial.data(), initial.size(), &upstream); break;
+                case MemoryResourceKind::UnsynchronizedPool: resource = &unsynchronizedPool.emplace(&upstream); break;
+                case MemoryResourceKind::SynchronizedPool: resource = &synchronizedPool.emplace(&upstream); break;
+                default: break;
+            }
+            std::string name = Name(kind);
+            std::string suffix = static_cast<std::size_t>(index) < this->messages.size() ? ", " + this->messages.at(index) : "";
+            try {
+                CountingResource counting(resource);
+                bool state = true;
+                if constexpr (std::is_void_v<std::invoke_result_t<Callable &, std::pmr::memory_resource *, Args &...>>) {
+                    std::invoke(method, &counting, args...);
+                }
+                else if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
+                    doNotOptimize(std::invoke(method, &counting, args...));
+                }
+                else {
+                    // if expected is smaller than the number of resources, we just use the last value as expected
+                    state = std::invoke(method, &counting, args...) == this->expected.at(std::min<unsigned long long>(this->expected.size() - 1, index));
+                }
+                unsigned long long upstreamAllocations = upstream.Allocations();
+                unsigned long long upstreamBytes = upstream.Bytes();
+                if(monotonic) {
+                    monotonic->release();
+                }
+                Timer timer(options.backend);
+                std::vector<double> samples;
+                samples.reserve(iterations);
+                for(int i = 0; i < iterations; i++) {
+                    CountingResource timed(resource);
+                    std::uint64_t start = timer.Start();
+                    if constexpr (std::is_void_v<std::invoke_result_t<Callable &, std::pmr::memory_resource *, Args &...>>) {
+                        std::invoke(method, &timed, args...);
+                    }
+                    else {
+                        doNotOptimize(std::invoke(method, &timed, args...));
+                    }
+                    samples.push_back(timer.Elapsed(start, timer.Stop()));
+                    if(monotonic) {
+                        monotonic->release();
+                    }
+                }
+                TimingStats timing(name, std::move(samples), this->groupNum);
+                stats.push_back(timing);
+                std::ostringstream out;
+                out << std::fixed << std::setprecision(1) << name << ": " << (state ? "Passed" : "Failed") << ", median "
+                    << timing.medianNs << " ns, " << counting.Allocations() << " allocations, " << counting.Bytes()
+                    << " bytes, peak " << counting.PeakBytes() << " bytes, upstream " << upstreamAllocations
+                    << " allocations, " << upstreamBytes << " bytes";
+                return {this->message + " " + out.str() + suffix, state, this->groupNum, index + 1};
+            }
+            catch(std::exception &e) {
+                return {this->message + " " + name + ": Exception Thrown: " + std::string(e.what()) + suffix, false, this->groupNum, index + 1};
+            }
+        }
+
+    public:
+        /**
+         * @brief Constructor
+         * @param Iterations How many timed calls per resource
+         * @param Expected The expected value for every resource, empty to only check for exceptions
+         * @param Message optional message that will print for every result
+         * @param Messages optional message that will print for nth result (nth resource)
+         * @param group The group number of the test
+         * @param Options The timer settings
+         * @param BufferSize Size of the initial buffer of the monotonic_buffer_resource
+         */
+        TestMemoryResource(int Iterations, std::vector<U> Expected, std::string Message = "", std::vector<std::string> Messages = {}, int group = 0, const TimingOptions &Options = {}, std::size_t BufferSize = 64 * 1024)
+            : VectorTest<U>(Expected, Message, Messages, group), iterations(Iterations), bufferSize(BufferSize), options(Options) {}
+
+        ~TestMemoryResource() = default;
+
+        /**
+         * @brief Run the callable under every resource
+         * @param method A callable function, lambda or method, whose first parameter is a std::pmr::memory_resource*
+         * @param args The list of extra arguments to be passed onto the Callable
+         * @return A vector of Result, one per MemoryResourceKind in declaration order
+         */
+        template<typename Callable, typename... Args>
+        std::vector<Result> RunAll(Callable &method, Args... args) {
+            int index = 0;
+            for(MemoryResourceKind kind : {MemoryResourceKind::NewDelete, MemoryResourceKind::Monotonic, MemoryResourceKind::UnsynchronizedPool, MemoryResourceKind::SynchronizedPool}) {
+                AffinityGuard pin(options.cpus);
+                this->results.push_back(RunOne(kind, index, method, args...));
+                index++;
+            }
+            return this->results;
+        }
+
+        /**
+         * @brief Get the timing summary of every resource
+         */
+        const std::vector<TimingStats> &GetStats() const {
+            return stats;
+        }
+    };
+
+    /**
+     * @brief An expensive test object that is built once per thread and reset between tests
+     * @tparam F The type of the fixture
+     *
+     * setup builds the fixture the first time a thread asks for it. Every later Get on that thread hands back the
+     * same object, after running the reset hook on it, so that tests start from a clean state without paying for
+     * setup again. Bind wraps a callable so that it gets the fixture as its first argument, which makes it usable with
+     * testRange, testTwoVectorMethod and everything else that takes a Callable. Threads of a TestScheduler
+     * each get their own fixture. teardown runs on every fixture when the Fixture is destroyed.
+     */
+    template<class F>
+    class Fixture {
+    private:
+        struct Instance {
+            std::unique_ptr<F> value;
+            bool used = false;
+        };
+
+        std::function<F()> setup;
+        std::function<void(F &)> reset;
+        std::function<void(F &)> teardown;
+        unsigned long long id;
+        mutable std::mutex mutex;
+        std::map<std::thread::id, std::unique_ptr<Instance>> instances;
+        std::atomic<unsigned long long> setups = 0;
+        std::atomic<unsigned long long> resets = 0;
+
+        static unsigned long long NextId() {
+            static std::atomic<unsigned long long> counter = 0;
+            return ++counter;
+        }
+
+    public:
+        /**
+         * @brief Constructor
+         * @param Setup Builds a fixture, called once per thread
+         * @param Reset Brings a used fixture back to its initial state, nullptr to reuse it as it is
+         * @param Teardown Cleans up a fixture before it is destroyed, nullptr for nothing
+         */
+        explicit Fixture(std::function<F()> Setup, std::function<void(F &)> Reset = nullptr, std::function<void(F &)> Teardown = nullptr)
+            : setup(std::move(Setup)), reset(std::move(Reset)), teardown(std::move(Teardown)), id(NextId()) {}
+
+        ~Fixture() {
+            Clear();
+        }
+
+        Fixture(const Fixture &) = delete;
+        Fixture &operator=(const Fixture &) = delete;
+
+        /**
+         * @brief Get the fixture of the calling thread
+         * @return The fixture, freshly built on the first call of a thread and reset on every call after that
+         */
+        F &Get() {
+            // the last fixture used by the thread is cached, so the lock is only taken when switching fixtures
+            thread_local unsigned long long cachedId = 0;
+            thread_local Instance *cached = nullptr;
+            if(cachedId != id) {
+                std::lock_guard<std::mutex> guard(mutex);
+                std::unique_ptr<Instance> &instance = instances[std::this_thread::get_id()];
+                if(!instance) {
+                    instance = std::make_unique<Instance>();
+                }
+                cached = instance.get();
+                cachedId = id;
+            }
+            if(!cached->value) {
+                cached->value = std::make_unique<F>(setup());
+                setups++;
+            }
+            else if(cached->used && reset) {
+                reset(*cached->value);
+                resets++;
+            }
+            cached->used = true;
+            return *cached->value;
+        }
+
+        /**
+         * @brief Wraps a callable so that it is called with the fixture of the calling thread as its first argument
+         * @param method A callable function, lambda or method whose first parameter is F&
+         * @return A lambda that calls method(Get(), args...), method has to outlive it
+         */
+        template<typename Callable>
+        auto Bind(Callable &method) {
+            return [this, &method](auto &&... args) -> decltype(auto) {
+                return std::invoke(method, Get(), std::forward<decltype(args)>(args)...);
+            };
+        }
+
+        /**
+         * @brief Tears down and destroys the fixtures of every thread, the next Get builds a new one
+         *
+         * Must not be called while other threads are using their fixture.
+         */
+        void Clear() {
+            std::lock_guard<std::mutex> guard(mutex);
+            for(auto &[thread, instance] : instances) {
+                if(instance->value && teardown) {
+                    teardown(*instance->value);
+                }
+                instance->value.reset();
+                instance->used = false;
+            }
+        }
+
+        /**
+         * @brief How many times setup ran
+         */
+        unsigned long long Setups() const {
+            return setups.load();
+        }
+
+        /**
+         * @brief How many times reset ran
+         */
+        unsigned long long Resets() const {
+            return resets.load();
+        }
+    };
+
+    /**
+     * @brief A fixture that is built once and handed to every test (or batch of tests) as a fork()ed copy
+     * @tparam F The type of the fixture
+     *
+     * For fixtures that tests change and that have no cheap reset. The parent builds the fixture once, and every
+     * batch runs in a child process that starts with a copy-on-write image of it, so each batch sees the exact same
+     * state for the cost of the pages it touches. The children write their Results back through a pipe. A child that
+     * crashes only loses its own batch, which is reported as failed. Where fork is not available (non POSIX systems)
+     * every batch gets a copy of the fixture made with F's copy constructor instead.
+     */
+    template<class F>
+    class ForkFixture {
+    private:
+        std::unique_ptr<F> value;
+        unsigned int maxChildren;
+
+#if defined(__unix__) || defined(__APPLE__)
+        struct Child {
+            pid_t pid;
+            int fd;
+            int first;
+            int last;
+            std::string data; // what it wrote so far
+        };
+
+        static void WriteAll(int fd, const std::string &data) {
+            std::size_t written = 0;
+            while(written < data.size()) {
+                ssize_t n = write(fd, data.data() + written, data.size() - written);
+                if(n < 0 && errno == EINTR) {
+                    continue;
+                }
+                if(n <= 0) {
+                    return;
+                }
+                written += static_cast<std::size_t>(n);
+            }
+        }
+
+        /**
+         * @brief Waits for a child that closed its pipe, and fills in failures for what it did not report
+         */
+        static void Finish(Child &child, std::vector<std::optional<Result>> &collected, int group) {
+            close(child.fd);
+            int status = 0;
+            while(waitpid(child.pid, &status, 0) < 0 && errno == EINTR) {}
+            const char *cursor = child.data.data();
+            const char *end = child.data.data() + child.data.size();
+            int index = child.first;
+            Result result{"", false};
+            while(index < child.last && Result::deserialize(cursor, end, result)) {
+                collected[index++] = result;
+            }
+            std::string reason = WIFSIGNALED(status) ? "child process crashed with signal " + std::to_string(WTERMSIG(status))
+                                                     : "child process exited with status " + std::to_string(WEXITSTATUS(status));
+            for(int first = index; index < child.last; index++) {
+                collected[index] = Result{index == first ? " Failed: " + reason + " on test " + std::to_string(index + 1)
+                                                         : " Not run: " + reason + " earlier in the batch", false, group, index + 1};
+            }
+        }
+
+        /**
+         * @brief Reads from every running child until at least one of them is done, and collects the ones that are
+         *
+         * All pipes are drained together, so no child waits on a full pipe for the ones started before it.
+         */
+        static void CollectAny(std::deque<Child> &running, std::vector<std::optional<Result>> &collected, int group) {
+            std::vector<pollfd> fds(running.size());
+            std::size_t before = running.size();
+            char buffer[65536];
+            while(running.size() == before) {
+                for(std::size_t c = 0; c < running.size(); c++) {
+                    fds[c] = pollfd{running[c].fd, POLLIN, 0};
+                }
+                if(::poll(fds.data(), static_cast<nfds_t>(running.size()), -1) < 0) {
+                    if(errno == EINTR) {
+                        continue;
+                    }
+                    throw std::runtime_error("ForkFixture: poll failed");
+                }
+                for(std::size_t c = running.size(); c-- > 0;) {
+                    if(fds[c].revents == 0) {
+                        continue;
+                    }
+                    ssize_t n = read(running[c].fd, buffer, sizeof(buffer));
+                    if(n < 0 && (errno == EINTR || errno == EAGAIN)) {
+                        continue;
+                    }
+                    if(n > 0) {
+                        running[c].data.append(buffer, static_cast<std::size_t>(n));
+                        continue;
+                    }
+                    Finish(running[c], collected, group);
+                    running.erase(running.begin() + static_cast<std::ptrdiff_t>(c));
+                }
+            }
+        }
+#endif
+
+    public:
+        /**
+         * @brief Constructor, builds the fixture
+         * @param setup Builds the fixture, called once
+         * @param MaxChildren How many child processes may run at once, 0 for std::thread::hardware_concurrency
+         */
+        explicit ForkFixture(const std::function<F()> &setup, unsigned int MaxChildren = 0)
+            : value(std::make_unique<F>(setup())), maxChildren(MaxChildren != 0 ? MaxChildren : std::max(1u, std::thread::hardware_concurrency())) {}
+
+        ~ForkFixture() = default;
+
+        /**
+         * @brief Get the fixture as it was built, tests never see changes made to it by other tests
+         */
+        F &Get() {
+            return *value;
+        }
+
+        /**
+         * @brief Runs count tests in batches, every batch in its own copy of the fixture
+         * @param count The number of tests
+         * @param batchSize How many tests share one copy, 1 for a pristine fixture per test
+         * @param group The group number for the Results of crashed batches
+         * @param test Runs test i on the fixture copy, test(int i, F &fixture) -> Result; if it throws, test i fails
+         * @return The Results of every test, in order
+         */
+        template<typename Test>
+        std::vector<Result> RunBatches(int count, unsigned int batchSize, int group, Test test) {
+            batchSize = std::max(1u, batchSize);
+            std::vector<std::optional<Result>> collected(std::max(count, 0));
+            // a test that throws fails, it never unwinds out of a child, which would go on running the parent's program
+            auto guarded = [&test, group](int i, F &fixture) {
+                try {
+                    return test(i, fixture);
+                }
+                catch(std::exception &e) {
+                    return Result{" Exception Thrown: " + std::string(e.what()) + " on test " + std::to_string(i + 1), false, group, i + 1};
+                }
+                catch(...) {
+                    return Result{" Exception Thrown: unknown exception on test " + std::to_string(i + 1), false, group, i + 1};
+                }
+            };
+#if defined(__unix__) || defined(__APPLE__)
+            std::deque<Child> running;
+            std::cout.flush(); // or the children print whatever is still buffered again
+            std::cerr.flush();
+            for(int first = 0; first < count; first += static_cast<int>(batchSize)) {
+                int last = std::min(count, first + static_cast<int>(batchSize));
+                while(running.size() >= maxChildren) {
+                    CollectAny(running, collected, group);
+                }
+                int fds[2];
+                if(pipe(fds) != 0) {
+                    throw std::runtime_error("ForkFixture: pipe failed");
+                }
+                pid_t pid = fork();
+                if(pid < 0) {
+                    close(fds[0]);
+                    close(fds[1]);
+                    throw std::runtime_error("ForkFixture: fork failed");
+                }
+                if(pid == 0) {
+                    CrashHandler::UninstallInChild();
+                    close(fds[0]);
+                    for(int i = first; i < last; i++) {
+                        std::string data;
+                        guarded(i, *value).serialize(data);
+                        WriteAll(fds[1], data); // one at a time, so that a crash keeps everything before it
+                    }
+                    close(fds[1]);
+                    _exit(0);
+                }
+                close(fds[1]);
+                running.push_back(Child{pid, fds[0], first, last, {}});
+            }
+            while(!running.empty()) {
+                CollectAny(running, collected, group);
+            }
+#else
+            for(int first = 0; first < count; first += static_cast<int>(batchSize)) {
+                F copy(*value);
+                for(int i = first; i < std::min(count, first + static_cast<int>(batchSize)); i++) {
+                    collected[i] = guarded(i, copy);
+                }
+            }
+#endif
+            std::vector<Result> results;
+            results.reserve(collected.size());
+            for(std::optional<Result> &result : collected) {
+                results.push_back(std::move(*result));
+            }
+            return results;
+        }
+    };
+
+    /**
+     * @brief Saves the progress of long sweeps to a file, so that a run that got killed can pick up where it stopped
+     *
+     * testRangeCheckpointed splits its range into chunks of ChunkSize() tests. Every finished chunk is recorded along
+     * with its failed Results, and at most every Interval the whole checkpoint (completed chunks, failures and the state
+     * of Rng()) is written to the file. The file is replaced atomically, so a kill during a save keeps the previous one.
+     * When a Checkpoint is created for a file that already exists it resumes: finished chunks are skipped, their
+     * failures are restored and the passing tests are recorded as passed. Sweeps are told apart by their group number,
+     * so the resumed program has to run the same tests in the same order.
+     */
+    class Checkpoint {
+    private:
+        std::string path;
+        unsigned int chunkSize;
+        std::chrono::seconds interval;
+        std::chrono::steady_clock::time_point lastSave = std::chrono::steady_clock::now();
+        std::map<std::pair<int, long long>, long long> completed; // (group, first) -> last
+        std::map<std::pair<int, long long>, std::vector<Result>> failures; // (group, first) -> failed results of the chunk
+        std::mt19937_64 random;
+        bool resumed = false;
+
+        static constexpr std::uint32_t fileVersion = 2;
+
+        template<typename T>
+        static void Put(std::string &out, T value) {
+            out.append(reinterpret_cast<const char *>(&value), sizeof(T));
+        }
+
+        template<typename T>
+        static bool Take(const char *&data, const char *end, T &value) {
+            if(end - data < static_cast<std::ptrdiff_t>(sizeof(T))) {
+                return false;
+            }
+            std::memcpy(&value, data, sizeof(T));
+            data += sizeof(T);
+            return true;
+        }
+
+        bool Load() {
+            std::ifstream file(path, std::ios::binary);
+            if(!file) {
+                return false;
+            }
+            std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            const char *cursor = data.data();
+            const char *end = data.data() + data.size();
+            std::uint32_t version = 0;
+            std::uint32_t length = 0;
+            if(data.compare(0, 4, "TLCP") != 0 || !Take(cursor += 4, end, version) || version != fileVersion
+               || !Take(cursor, end, length) || end - cursor < static_cast<std::ptrdiff_t>(length)) {
+                return false;
+            }
+            std::istringstream state(std::string(cursor, length));
+            if(!(state >> random)) {
+                return false;
+            }
+            cursor += length;
+            std::uint64_t chunks = 0;
+            if(!Take(cursor, end, chunks)) {
+                return false;
+            }
+            for(std::uint64_t c = 0; c < chunks; c++) {
+                std::int32_t group = 0;
+                std::int64_t first = 0;
+                std::int64_t last = 0;
+                std::uint32_t failed = 0;
+                if(!Take(cursor, end, group) || !Take(cursor, end, first) || !Take(cursor, end, last) || !Take(cursor, end, failed)) {
+                    return false;
+                }
+                if(failed > static_cast<std::size_t>(end - cursor) / Result::serializedHeader) { // the count comes from the file
+                    return false;
+                }
+                std::vector<Result> chunkFailures(failed, Result{"", false});
+                for(Result &result : chunkFailures) {
+                    if(!Result::deserialize(cursor, end, result)) {
+                        return false;
+                    }
+                }
+                completed[{group, first}] = last;
+                if(!chunkFailures.empty()) {
+                    failures[{group, first}] = std::move(chunkFailures);
+                }
+            }
+            return true;
+        }
+
+    public:
+        /**
+         * @brief Constructor, resumes from path if it holds a checkpoint
+         * @param Path The checkpoint file
+         * @param ChunkSize How many tests make up a chunk, the unit of work that is skipped on resume
+         * @param Interval The minimum time between two saves
+         * @param seed The seed of Rng() when not resuming
+         */
+        explicit Checkpoint(std::string Path, unsigned int ChunkSize = 4096, std::chrono::seconds Interval = std::chrono::seconds(30), std::uint64_t seed = 0x7e57)
+            : path(std::move(Path)), chunkSize(std::max(1u, ChunkSize)), interval(Interval), random(seed) {
+            resumed = Load();
+            if(!resumed) {
+                completed.clear();
+                failures.clear();
+                random.seed(seed);
+            }
+        }
+
+        ~Checkpoint() = default;
+
+        /**
+         * @brief Whether this checkpoint picked up a previous run
+         */
+        bool Resumed() const {
+            return resumed;
+        }
+
+        /**
+         * @brief A random number generator whose state is saved with the checkpoint, for randomized sweeps
+         */
+        std::mt19937_64 &Rng() {
+            return random;
+        }
+
+        unsigned int ChunkSize() const {
+            return chunkSize;
+        }
+
+        /**
+         * @brief Whether the chunk starting at first of a group was finished before
+         */
+        bool Completed(int group, long long first) const {
+            return completed.count({group, first}) != 0;
+        }
+
+        /**
+         * @brief The failed Results recorded for a finished chunk
+         */
+        const std::vector<Result> &Failures(int group, long long first) const {
+            static const std::vector<Result> none;
+            auto found = failures.find({group, first});
+            return found == failures.end() ? none : found->second;
+        }
+
+        /**
+         * @brief Records a finished chunk, and saves if the last save was longer than Interval ago
+         * @param group The group number of the sweep
+         * @param first The first value of the chunk
+         * @param last The last value of the chunk
+         * @param chunkResults The Results of the chunk, only the failed ones are kept
+         */
+        void Complete(int group, long long first, long long last, const std::vector<Result> &chunkResults) {
+            completed[{group, first}] = last;
+            std::vector<Result> failed;
+            std::copy_if(chunkResults.begin(), chunkResults.end(), std::back_inserter(failed), [](const Result &result) { return !result.state; });
+            if(!failed.empty()) {
+                failures[{group, first}] = std::move(failed);
+            }
+            if(std::chrono::steady_clock::now() - lastSave >= interval) {
+                Save();
+            }
+        }
+
+        /**
+         * @brief Writes the checkpoint to a temporary file and renames it over the checkpoint file
+         * @return false if the file could not be written
+         */
+        bool Save() {
+            std::string data = "TLCP";
+            Put(data, fileVersion);
+            std::ostringstream state;
+            state << random;
+            Put(data, static_cast<std::uint32_t>(state.str().size()));
+            data += state.str();
+            Put(data, static_cast<std::uint64_t>(completed.size()));
+            for(const auto &[chunk, last] : completed) {
+                const std::vector<Result> &chunkFailures = Failures(chunk.first, chunk.second);
+                Put(data, static_cast<std::int32_t>(chunk.first));
+                Put(data, static_cast<std::int64_t>(chunk.second));
+                Put(data, static_cast<std::int64_t>(last));
+                Put(data, static_cast<std::uint32_t>(chunkFailures.size()));
+                for(const Result &result : chunkFailures) {
+                    result.serialize(data);
+                }
+            }
+            std::string temporary = path + ".tmp";
+            {
+                std::ofstream file(temporary, std::ios::binary | std::ios::trunc);
+                if(!file.write(data.data(), static_cast<std::streamsize>(data.size())) || !file.flush()) {
+                    return false;
+                }
+            }
+            lastSave = std::chrono::steady_clock::now();
+            return std::rename(temporary.c_str(), path.c_str()) == 0;
+        }
+
+        /**
+         * @brief Deletes the checkpoint file, for when the whole run finished
+         */
+        void Remove() {
+            std::remove(path.c_str());
+        }
+    };
+
+    /**
+     * @brief What testExceptions expects one input to throw
+     */
+    struct ExpectedThrow {
+        static constexpr int NoThrow = -1; // the input must not throw
+        static constexpr int AnyListed = -2; // any exception of the catch list will do
+        static constexpr int Unlisted = -3; // a std::exception that is not in the catch list
+        static constexpr int NonStandard = -4; // an exception that does not derive from std::exception
+
+        int type = AnyListed; // the index of the expected exception in the catch list, or one of the constants above
+        std::string message; // what() has to be exactly this, empty for any message
+    };
+
+    /**
+     * @brief A non-owning, filtered view of the results of a Tester
+     *
+     * A view holds a pointer to the results and shared, immutable filters, nothing else. Iterating it walks the
+     * stored results and skips the ones that do not match, so no Result is ever copied. Every filter returns a new
+     * view, so they can be chained. Iterators and the pointers of TopByDuration only depend on the results of the
+     * Tester, not on the view, so they stay valid after a temporary view is gone, e.g. tester.query().State(false).begin().
+     * Anything that adds results to the Tester invalidates views, iterators and pointers alike.
+     */
+    class ResultView {
+    private:
+        struct Filter {
+            std::optional<bool> state;
+            std::vector<std::string> substrings;
+            std::function<bool(const Result &)> where;
+
+            bool Matches(const Result &result) const {
+                return (!state || result.state == *state)
+                       && std::all_of(substrings.begin(), substrings.end(), [&result](const std::string &text) { return result.message.find(text) != std::string::npos; })
+                       && (!where || where(result));
+            }
+        };
+
+        const std::vector<std::vector<Result>> *groups;
+        std::size_t firstGroup = 0; // index in groups, not the group number
+        std::size_t lastGroup = 0; // one past the end
+        std::shared_ptr<const Filter> filter = std::make_shared<const Filter>();
+
+        /**
+         * @brief A copy of this view with a changed filter
+         */
+        template<typename Change>
+        ResultView Filtered(Change change) const {
+            ResultView view = *this;
+            Filter changed = *filter;
+            change(changed);
+            view.filter = std::make_shared<const Filter>(std::move(changed));
+            return view;
+        }
+
+    public:
+        /**
+         * @brief Iterates over the matching results, in group and test order
+         */
+        class iterator {
+        private:
+            const std::vector<std::vector<Result>> *groups = nullptr;
+            std::shared_ptr<const Filter> filter;
+            std::size_t lastGroup = 0;
+            std::size_t group = 0;
+            std::size_t index = 0;
+
+            void Skip() {
+                while(group < lastGroup) {
+                    const std::vector<Result> &results = (*groups)[group];
+                    while(index < results.size() && !filter->Matches(results[index])) {
+                        index++;
+                    }
+                    if(index < results.size()) {
+                        return;
+                    }
+                    group++;
+                    index = 0;
+                }
+            }
+
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type = Result;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const Result *;
+            using reference = const Result &;
+
+            iterator() = default;
+            iterator(const ResultView &view, std::size_t Group) : groups(view.groups), filter(view.filter), lastGroup(view.lastGroup), group(Group) {
+                Skip();
+            }
+
+            reference operator*() const {
+                return (*groups)[group][index];
+            }
+            pointer operator->() const {
+                return &**this;
+            }
+            iterator &operator++() {
+                index++;
+                Skip();
+                return *this;
+            }
+            iterator operator++(int) {
+                iterator copy = *this;
+                ++*this;
+                return copy;
+            }
+            bool operator==(const iterator &other) const {
+                return group == other.group && index == other.index;
+            }
+        };
+
+        explicit ResultView(const std::vector<std::vector<Result>> &results) : groups(&results), lastGroup(results.size()) {}
+
+        iterator begin() const {
+            return iterator(*this, firstGroup);
+        }
+        iterator end() const {
+            return iterator(*this, lastGroup);
+        }
+
+        /**
+         * @brief Only the results that passed (true) or failed (false)
+         */
+        ResultView State(bool passed) const {
+            return Filtered([passed](Filter &changed) { changed.state = passed; });
+        }
+
+        /**
+         * @brief Only the results of the groups first to last, inclusive
+         */
+        ResultView Groups(int first, int last) const {
+            ResultView view = *this;
+            view.firstGroup = std::clamp<std::size_t>(static_cast<std::size_t>(std::max(first, 1)) - 1, firstGroup, lastGroup);
+            view.lastGroup = std::clamp<std::size_t>(static_cast<std::size_t>(std::max(last, 0)), view.firstGroup, lastGroup);
+            return view;
+        }
+
+        /**
+         * @brief Only the results whose message contains text
+         */
+        ResultView Containing(std::string text) const {
+            return Filtered([&text](Filter &changed) { changed.substrings.push_back(std::move(text)); });
+        }
+
+        /**
+         * @brief Only the results for which predicate returns true
+         */
+        ResultView Where(std::function<bool(const Result &)> predicate) const {
+            return Filtered([&predicate](Filter &changed) {
+                if(changed.where) {
+                    changed.where = [previous = std::move(changed.where), predicate = std::move(predicate)](const Result &result) { return previous(result) && predicate(result); };
+                }
+                else {
+                    changed.where = std::move(predicate);
+                }
+            });
+        }
+
+        /**
+         * @brief The number of matching results
+         */
+        std::size_t Count() const {
+            if(!filter->state && filter->substrings.empty() && !filter->where) {
+                std::size_t count = 0;
+                for(std::size_t g = firstGroup; g < lastGroup; g++) {
+                    count += (*groups)[g].size();
+                }
+                return count;
+            }
+            return static_cast<std::size_t>(std::distance(begin(), end()));
+        }
+
+        bool Empty() const {
+            return begin() == end();
+        }
+
+        /**
+         * @brief Counts the matching results by a key
+         * @tparam Key A Callable that takes a const Result & and returns something that can be a std::map key
+         * @param key Gives the key of a result
+         * @return The number of matching results for every key
+         */
+        template<typename Key>
+        auto CountBy(Key key) const {
+            std::map<std::decay_t<std::invoke_result_t<Key &, const Result &>>, std::size_t> counts;
+            for(const Result &result : *this) {
+                counts[std::invoke(key, result)]++;
+            }
+            return counts;
+        }
+
+        /**
+         * @brief The number of matching results in every group, as group number -> (passed, failed)
+         */
+        std::map<int, std::pair<std::size_t, std::size_t>> CountByGroup() const {
+            std::map<int, std::pair<std::size_t, std::size_t>> counts;
+            for(const Result &result : *this) {
+                auto &count = counts[result.groupNum];
+                (result.state ? count.first : count.second)++;
+            }
+            return counts;
+        }
+
+        /**
+         * @brief The k slowest matching results, slowest first
+         * @param k How many to return
+         * @return Pointers into the results of the Tester, valid until results are added to it
+         */
+        std::vector<const Result *> TopByDuration(std::size_t k) const {
+            auto slower = [](const Result *a, const Result *b) { return a->durationNs > b->durationNs; };
+            std::vector<const Result *> top; // a min-heap of the k slowest so far
+            top.reserve(k);
+            for(const Result &result : *this) {
+                if(top.size() < k) {
+                    top.push_back(&result);
+                    std::push_heap(top.begin(), top.end(), slower);
+                }
+                else if(k > 0 && result.durationNs > top.front()->durationNs) {
+                    std::pop_heap(top.begin(), top.end(), slower);
+                    top.back() = &result;
+                    std::push_heap(top.begin(), top.end(), slower);
+                }
+            }
+            std::sort_heap(top.begin(), top.end(), slower);
+            return top;
+        }
+    };
+
+    /**
+     * @brief One step of a model-based test, applied to both the system under test and a reference model
+     *
+     * A step is made by a Generator from a random number generator, e.g. "put a random key", and knows how to apply
+     * itself to both sides. After every step testModel compares what the two sides observed.
+     *
+     * @tparam System The type of the system under test
+     * @tparam Model The type of the reference model
+     * @tparam Observation What a step returns on both sides, compared with operator==
+     */
+    template<class System, class Model, class Observation>
+    class ModelOperation {
+    public:
+        using Generator = std::function<ModelOperation(std::mt19937_64 &)>;
+
+        std::string description; // shown in the reproduction, e.g. "put(3, 7)"
+        std::function<Observation(System &)> onSystem;
+        std::function<Observation(Model &)> onModel;
+
+        ModelOperation(std::string Description, std::function<Observation(System &)> OnSystem, std::function<Observation(Model &)> OnModel)
+            : description(std::move(Description)), onSystem(std::move(OnSystem)), onModel(std::move(OnModel)) {}
+    };
+
+   /**
+    * @brief A tester container that stores information about ran tests
+    *
+    * Allows the testing of various methods and then those results to be stored into one
+    * vector of results, rather than having multiple different tests that might make testing
+    * simpler objects harder.
+    */
+    class Tester {
+    private:
+        std::vector<std::vector<Result>> results;
+        std::vector<TimingStats> timings;
+        TimingOptions timingOptions;
+
+        ProgressReporter *progress = nullptr;
+        EventPublisher *events = nullptr;
+        std::vector<std::pair<int, std::string>> tags; // (first group, tag), in order of the groups
+        unsigned int threads = 0; // for the tests that run in parallel, 0 for std::thread::hardware_concurrency
+        CliffOptions cliffOptions;
+        static constexpr std::uint32_t resultFileVersion = 2;
+
+        friend class TestScheduler;
+        friend class TestPlan;
+
+        /**
+         * @brief Connects a test to the ProgressReporter, if there is one
+         * @param test The test that is about to run
+         * @param count The number of tests it will run
+         */
+        template<class U>
+        void watch(VectorTest<U> &test, long long count) {
+            if(progress != nullptr) {
+                progress->Expect(static_cast<unsigned long long>(std::max(count, 0LL)));
+                test.SetProgress(progress);
+            }
+            test.SetEvents(events);
+        }
+
+        /**
+         * @brief Publishes the summary of a group to the EventPublisher, if there is one
+         * @param group The Results of the group
+         */
+        void summarize(const std::vector<Result> &group) {
+            if(events != nullptr && !group.empty()) {
+                auto passed = static_cast<std::uint64_t>(std::count_if(group.begin(), group.end(), [](const Result &result) { return result.state; }));
+                events->Summary(group.front().groupNum, passed, group.size() - passed);
+            }
+        }
+
+        /**
+         * @brief Runs a sequence of operations on a new system and a copy of the model
+         * @return The index of the first step where they disagree, or -1; what went wrong is put in detail
+         */
+        template<typename Factory, typename Model, typename Operation>
+        static long long runModelSequence(Factory &factory, const Model &model, const std::vector<const Operation *> &sequence, std::string &detail) {
+            std::size_t step = 0;
+            try {
+                auto system = std::invoke(factory);
+                Model reference = model;
+                for(; step < sequence.size(); step++) {
+                    auto observed = sequence[step]->onSystem(system);
+                    auto expected = sequence[step]->onModel(reference);
+                    if(!(observed == expected)) {
+                        detail = "system " + toDisplay(observed) + ", model " + toDisplay(expected);
+                        return static_cast<long long>(step);
+                    }
+                }
+            }
+            catch(std::exception &e) {
+                detail = "Exception Thrown: " + std::string(e.what());
+                return static_cast<long long>(step);
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Calls a Callable and finds which exception of a catch list it threw
+         * @tparam Exceptions The catch list, checked in order
+         * @param call Calls the Callable
+         * @param error Set to the exception, which keeps what points to alive
+         * @param what Set to what() of the exception, if it is a std::exception
+         * @return The index in the catch list, ExpectedThrow::NoThrow, ExpectedThrow::Unlisted for a std::exception
+         *         that is not listed and ExpectedThrow::NonStandard for anything else
+         */
+        template<typename... Exceptions, typename Call>
+        static int catchListed(Call &call, std::exception_ptr &error, const char *&what) {
+            try {
+                call();
+                return ExpectedThrow::NoThrow;
+            }
+            catch(...) {
+                error = std::current_exception();
+            }
+            int found = ExpectedThrow::NonStandard;
+            int index = 0;
+            auto check = [&]<typename E>() {
+                if(found == ExpectedThrow::NonStandard) {
+                    try {
+                        std::rethrow_exception(error);
+                    }
+                    catch(const E &e) {
+                        found = index;
+                        if constexpr(std::is_base_of_v<std::exception, E>) {
+                            what = e.what();
+                        }
+                    }
+                    catch(...) {}
+                }
+                index++;
+            };
+            (check.template operator()<Exceptions>(), ...);
+            if(found == ExpectedThrow::NonStandard) {
+                try {
+                    std::rethrow_exception(error);
+                }
+                catch(const std::exception &e) {
+                    found = ExpectedThrow::Unlisted;
+                    what = e.what();
+                }
+                catch(...) {}
+            }
+            return found;
+        }
+
+        /**
+         * @brief Runs the inputs of testExceptions in parallel batches
+         * @param count The number of inputs
+         * @param labelAt Gives the text that names the nth input in a message
+         * @param callAt Calls the Callable with the nth input
+         * @return The mismatches in input order, followed by a summary Result
+         */
+        template<typename... Exceptions, typename LabelAt, typename CallAt>
+        std::vector<Result> exceptionBatch(std::size_t count, const std::vector<ExpectedThrow> &expected, LabelAt labelAt, CallAt callAt) {
+            for(const ExpectedThrow &want : expected) {
+                if(want.type < ExpectedThrow::NonStandard || want.type >= static_cast<int>(sizeof...(Exceptions))) {
+                    throw std::invalid_argument("testExceptions: ExpectedThrow type " + std::to_string(want.type) + " is not in the catch list of "
+                                                + std::to_string(sizeof...(Exceptions)) + " exceptions");
+                }
+            }
+            int group = static_cast<int>(results.size() + 1);
+            const std::string names[] = {typeName<Exceptions>()..., ""};
+            static const ExpectedThrow anyListed;
+            auto describe = [&names](int type) -> std::string {
+                switch(type) {
+                    case ExpectedThrow::NoThrow:
+                        return "no exception";
+                    case ExpectedThrow::AnyListed:
+                        return "an exception of the catch list";
+                    case ExpectedThrow::Unlisted:
+                        return "an unlisted std::exception";
+                    case ExpectedThrow::NonStandard:
+                        return "a non-std::exception";
+                    default:
+                        return names[type];
+                }
+            };
+            constexpr std::size_t batch = 1024;
+            std::vector<std::vector<Result>> mismatches((count + batch - 1) / batch);
+            parallelFor(count, threads, batch, [&](std::size_t begin, std::size_t end) {
+                std::vector<Result> &found = mismatches[begin / batch];
+                for(std::size_t i = begin; i < end; i++) {
+                    const ExpectedThrow &want = expected.empty() ? anyListed : expected[std::min(expected.size() - 1, i)];
+                    std::exception_ptr error;
+                    const char *what = nullptr;
+                    auto call = [&] { callAt(i); };
+                    int type = catchListed<Exceptions...>(call, error, what);
+                    bool typeMatches = type == want.type || (want.type == ExpectedThrow::AnyListed && type >= 0);
+                    bool messageMatches = want.message.empty() || (what != nullptr && want.message == what);
+                    if(typeMatches && messageMatches) {
+                        continue;
+                    }
+                    std::string text = " Failed: " + labelAt(i) + ": expected " + describe(want.type);
+                    if(!want.message.empty()) {
+                        text += " \"" + want.message + "\"";
+                    }
+                    text += ", got " + describe(type);
+                    if(what != nullptr) {
+                        text += " \"" + std::string(what) + "\"";
+                    }
+                    found.emplace_back(text, false, group, static_cast<int>(i + 1));
+                }
+            });
+            std::vector<Result> testResults;
+            for(std::vector<Result> &found : mismatches) {
+                std::move(found.begin(), found.end(), std::back_inserter(testResults));
+            }
+            std::size_t failed = testResults.size();
+            testResults.emplace_back(std::string(" ") + (failed == 0 ? "Passed" : "Failed") + ": " + std::to_string(count - failed) + "/"
+                                     + std::to_string(count) + " inputs threw as expected", failed == 0, group, static_cast<int>(count + 1));
+            results.emplace_back(testResults);
+            return testResults;
+        }
+
+        /**
+         * @brief Counts the indexes in [begin, end) for which violates returns true, in parallel, and adds the Result
+         * @param name What was checked, e.g. "sorted"
+         * @param begin The first index to check
+         * @param end One past the last index to check
+         * @param elements The number of elements, for the message
+         * @param violates Returns whether index i breaks the invariant, without side effects
+         * @return A Result with the number of violations and the first one
+         *
+         * The indexes are checked in blocks of 256 with a branch free count, which the compiler can vectorize for
+         * simple element types. Only a block with a violation is scanned again for its first index.
+         */
+        template<typename Violates>
+        Result checkInvariant(const std::string &name, std::size_t begin, std::size_t end, std::size_t elements, Violates violates) {
+            constexpr std::size_t block = 256;
+            std::atomic<std::size_t> violations = 0;
+            std::atomic<std::size_t> first = std::numeric_limits<std::size_t>::max();
+            std::size_t count = end > begin ? end - begin : 0;
+            parallelFor(count, threads, 1 << 16, [&](std::size_t from, std::size_t to) {
+                std::size_t found = 0;
+                std::size_t firstFound = std::numeric_limits<std::size_t>::max();
+                for(std::size_t blockBegin = begin + from; blockBegin < begin + to; blockBegin += block) {
+                    std::size_t blockEnd = std::min(begin + to, blockBegin + block);
+                    std::size_t hits = 0;
+                    for(std::size_t i = blockBegin; i < blockEnd; i++) {
+                        hits += violates(i) ? 1 : 0;
+                    }
+                    if(hits > 0 && firstFound == std::numeric_limits<std::size_t>::max()) {
+                        for(std::size_t i = blockBegin; i < blockEnd; i++) {
+                            if(violates(i)) {
+                                firstFound = i;
+                                break;
+                            }
+                        }
+                    }
+                    found += hits;
+                }
+                violations += found;
+                std::size_t seen = first.load();
+                while(firstFound < seen && !first.compare_exchange_weak(seen, firstFound)) {}
+            });
+            std::string message = violations == 0
+                                  ? " Passed: " + name + ", " + std::to_string(elements) + " elements"
+                                  : " Failed: " + name + ", " + std::to_string(violations.load()) + " violations in " + std::to_string(elements)
+                                    + " elements, first at index " + std::to_string(first.load());
+            Result result(message, violations == 0, static_cast<int>(results.size() + 1), 1);
+            results.emplace_back(std::vector<Result>{result});
+            return result;
+        }
+
+        /**
+         * @brief Times a Callable over a range and adds a failing Result to testResults for every performance cliff
+         * @param testResults The Results of the range, cliffs are added after them
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         * @param method The Callable, called as method(i, args...)
+         *
+         * Does nothing unless cliffOptions.enabled. Every point is called repeatedly until a round takes at least
+         * minTime, and the median of the rounds is divided by the index. A cliff is a point where the median of the
+         * window points from it on is threshold times the median of the window points before it; of consecutive
+         * such points the steepest one is reported.
+         */
+        template<typename Callable, typename... Args>
+        void detectCliffs(std::vector<Result> &testResults, int from, int to, Callable &method, Args... args) {
+            if(!cliffOptions.enabled || to <= from) {
+                return;
+            }
+            std::vector<int> points;
+            auto span = static_cast<std::size_t>(static_cast<long long>(to) - from + 1);
+            if(cliffOptions.points == 0 || span <= cliffOptions.points) {
+                for(long long i = from; i <= to; i++) {
+                    points.push_back(static_cast<int>(i));
+                }
+            }
+            else {
+                double low = std::max(1.0, static_cast<double>(from));
+                for(std::size_t k = 0; k < cliffOptions.points; k++) {
+                    double at = low * std::pow(static_cast<double>(to) / low, static_cast<double>(k) / static_cast<double>(cliffOptions.points - 1));
+                    auto point = static_cast<int>(std::clamp(std::llround(at), static_cast<long long>(from), static_cast<long long>(to)));
+                    if(points.empty() || point > points.back()) {
+                        points.push_back(point);
+                    }
+                }
+            }
+            Timer timer(timingOptions.backend);
+            auto timeOnce = [&](int i, long long repetitions) {
+                std::uint64_t start = timer.Start();
+                for(long long r = 0; r < repetitions; r++) {
+                    if constexpr(std::is_void_v<std::invoke_result_t<Callable &, int, Args &...>>) {
+                        std::invoke(method, i, args...);
+                    }
+                    else {
+                        doNotOptimize(std::invoke(method, i, args...));
+                    }
+                }
+                return timer.Elapsed(start, timer.Stop());
+            };
+            std::vector<double> cost;
+            try {
+                for(int point : points) {
+                    long long repetitions = 1;
+                    double elapsed = timeOnce(point, repetitions);
+                    while(elapsed < static_cast<double>(cliffOptions.minTime.count()) && repetitions < (1LL << 40)) {
+                        repetitions *= std::clamp(static_cast<long long>(static_cast<double>(cliffOptions.minTime.count()) / std::max(elapsed, 1.0)) + 1, 2LL, 100LL);
+                        elapsed = timeOnce(point, repetitions);
+                    }
+                    std::vector<double> rounds;
+                    for(int round = 0; round < std::max(1, cliffOptions.rounds); round++) {
+                        rounds.push_back(timeOnce(point, repetitions) / static_cast<double>(repetitions));
+                    }
+                    std::nth_element(rounds.begin(), rounds.begin() + static_cast<std::ptrdiff_t>(rounds.size() / 2), rounds.end());
+                    double median = rounds[rounds.size() / 2];
+                    cost.push_back(cliffOptions.perElement ? median / std::max(1, std::abs(point)) : median);
+                }
+            }
+            catch(std::exception &) {
+                return; // the failing index is already in testResults
+            }
+            auto medianOf = [&cost](std::size_t begin, std::size_t end) {
+                std::vector<double> part(cost.begin() + static_cast<std::ptrdiff_t>(begin), cost.begin() + static_cast<std::ptrdiff_t>(end));
+                std::sort(part.begin(), part.end());
+                return (part[(part.size() - 1) / 2] + part[part.size() / 2]) / 2;
+            };
+            auto window = static_cast<std::size_t>(std::max(1, cliffOptions.window));
+            int group = static_cast<int>(results.size() + 1);
+            std::size_t best = 0;
+            double bestRatio = 0;
+            auto report = [&]() {
+                if(bestRatio == 0) {
+                    return;
+                }
+                std::ostringstream text;
+                text << " Cliff: " << (cliffOptions.perElement ? "time per element " : "time ") << std::setprecision(3) << bestRatio << "x higher from "
+                     << points[best] << " on (" << std::fixed << std::setprecision(1) << medianOf(best - window, best) << " ns up to " << points[best - 1]
+                     << ", " << medianOf(best, best + window) << " ns from " << points[best] << ")";
+                testResults.emplace_back(text.str(), false, group, static_cast<int>(testResults.size() + 1));
+                bestRatio = 0;
+            };
+            for(std::size_t k = window; k + window <= cost.size(); k++) {
+                double ratio = medianOf(k, k + window) / std::max(medianOf(k - window, k), 1e-12);
+                if(ratio >= cliffOptions.threshold) {
+                    if(ratio > bestRatio) {
+                        best = k;
+                        bestRatio = ratio;
+                    }
+                }
+                else {
+                    report();
+                }
+            }
+            report();
+        }
+
+        /**
+         * @brief Calls a sampler of testDistribution, with the random number generator of its batch if it takes one
+         */
+        template<typename Sampler>
+        static auto drawSample(Sampler &sampler, std::mt19937_64 &random) {
+            if constexpr(std::is_invocable_v<Sampler &, std::mt19937_64 &>) {
+                return std::invoke(sampler, random);
+            }
+            else {
+                return std::invoke(sampler);
+            }
+        }
+
+        /**
+         * @brief Adds the Result of a distribution test as its own group
+         * @param passed Whether the p-value is at least alpha
+         * @param details What was measured, e.g. "chi-square 12.3 with 9 degrees of freedom"
+         * @param pValue The p-value
+         * @param alpha The threshold
+         */
+        Result distributionResult(bool passed, const std::string &details, double pValue, double alpha) {
+            std::ostringstream text;
+            text << (passed ? "Passed: " : "Failed: ") << details << ", p = " << std::setprecision(4) << pValue << " (alpha " << alpha << ")";
+            Result result(text.str(), passed, static_cast<int>(results.size() + 1), 1);
+            results.emplace_back(std::vector<Result>{result});
+            return result;
+        }
+
+        /**
+         * @brief Runs the cases of testMetamorphic in parallel batches
+         * @param count The number of source inputs
+         * @param inputAt Gives the nth source input
+         * @param method The Callable, called as method(input, args...)
+         * @param transform Makes the follow-up input of a source input
+         * @param relation Checks the outputs as relation(sourceOutput, followUpOutput)
+         *        or relation(source, sourceOutput, followUp, followUpOutput)
+         * @return The violations in input order, followed by a summary Result
+         */
+        template<typename InputAt, typename Callable, typename Transform, typename Relation, typename... Args>
+        std::vector<Result> metamorphic(std::size_t count, InputAt inputAt, Callable &method, Transform &transform, Relation &relation, Args... args) {
+            int group = static_cast<int>(results.size() + 1);
+            constexpr std::size_t batch = 1024;
+            std::vector<std::vector<Result>> violations((count + batch - 1) / batch);
+            parallelFor(count, threads, batch, [&](std::size_t begin, std::size_t end) {
+                std::vector<Result> &found = violations[begin / batch];
+                for(std::size_t i = begin; i < end; i++) {
+                    std::optional<std::decay_t<std::invoke_result_t<InputAt &, std::size_t>>> kept; // printed only for a failure
+                    try {
+                        auto &input = kept.emplace(inputAt(i));
+                        auto followUp = std::invoke(transform, input);
+                        auto output = std::invoke(method, input, args...);
+                        auto followUpOutput = std::invoke(method, followUp, args...);
+                        bool held;
+                        if constexpr(std::is_invocable_v<Relation &, decltype(input), decltype(output), decltype(followUp), decltype(followUpOutput)>) {
+                            held = std::invoke(relation, input, output, followUp, followUpOutput);
+                        }
+                        else {
+                            held = std::invoke(relation, output, followUpOutput);
+                        }
+                        if(!held) {
+                            found.emplace_back(" Relation violated: f(" + toDisplay(input) + ") = " + toDisplay(output) + ", f(" + toDisplay(followUp) + ") = "
+                                               + toDisplay(followUpOutput), false, group, static_cast<int>(i + 1));
+                        }
+                    }
+                    catch(std::exception &e) {
+                        found.emplace_back(" Exception Thrown: " + std::string(e.what()) + " on " + (kept ? toDisplay(*kept) : "input " + std::to_string(i + 1)), false, group,
+                                           static_cast<int>(i + 1));
+                    }
+                }
+            });
+            std::vector<Result> testResults;
+            for(std::vector<Result> &found : violations) {
+                std::move(found.begin(), found.end(), std::back_inserter(testResults));
+            }
+            std::size_t failed = testResults.size();
+            testResults.emplace_back(std::string(" ") + (failed == 0 ? "Passed" : "Failed") + ": relation held for " + std::to_string(count - failed) + "/"
+                                     + std::to_string(count) + " inputs", failed == 0, group, static_cast<int>(count + 1));
+            results.emplace_back(testResults);
+            return testResults;
+        }
 
-            return this->results;
+        /**
+         * @brief Appends a Result to a report data file as [group, test, state, durationNs, message]
+         */
+        static void appendReportRow(std::string &out, const Result &result) {
+            out += '[' + std::to_string(result.groupNum) + ',' + std::to_string(result.testNum) + ',' + (result.state ? '1' : '0') + ','
+                   + std::to_string(result.durationNs) + ',';
+            appendJsonString(out, result.message);
+            out += ']';
         }
 
         /**
-          * @brief Run all of the tests
-          * @param method A callable function, lambda or method
-          * @return A vector of Result with the results
-          *
-          * Tests a function where the nth element in the actual vector is used as the 1st argument for the
-          * method that is passed through on the RunAll function call.
-          * All results will then be checked with the nth element in the result vector, if provided. Otherwise,
-          * check only for exceptions.
-          *
-          */
-        template<typename Callable>
-        std::vector<Result> RunAllNoArgs(Callable& method) {
-            for(int i = 0; i < actual.size(); i++) {
-                bool state = false;
-                std::string result;
-                try {
-                    if(this->expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
-                        std::invoke(method, actual[i]);
-                        result = std::string("Passed: ") + std::to_string(i);
-                    }
-                    else {
-                        state = std::invoke(method, actual[i]) == this->expected.at(std::min<unsigned long long int>(this->expected.size() - 1, i));
-                        result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(i);
-                    }
+         * @brief Writes a whole file, for writeReport
+         */
+        static bool writeFile(const std::filesystem::path &path, const std::string &content) {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            return file.write(content.data(), static_cast<std::streamsize>(content.size())) && file.flush();
+        }
+
+        static constexpr const char *reportPage = R"TLHTML(<!DOCTYPE html>
+<html>
+<head>
+<meta charset="utf-8">
+<title>Test Report</title>
+<style>
+body { font-family: sans-serif; margin: 1em; }
+table.summary { border-collapse: collapse; margin-bottom: 1em; }
+table.summary td, table.summary th { border: 1px solid #ccc; padding: 2px 8px; text-align: right; }
+#controls { margin: 0.5em 0; }
+#view { height: 70vh; overflow-y: auto; position: relative; border: 1px solid #ccc; font-family: monospace; }
+#rows { position: absolute; left: 0; right: 0; }
+.row { height: 20px; line-height: 20px; white-space: nowrap; overflow: hidden; }
+.row span { display: inline-block; padding: 0 6px; }
+.row .g, .row .t { width: 6em; text-align: right; }
+.row .tag { width: 10em; }
+.row .s { width: 4em; }
+.row .d { width: 8em; text-align: right; }
+.pass { color: #186a18; }
+.fail { color: #b01818; font-weight: bold; }
+</style>
+</head>
+<body>
+<h1>Test Report</h1>
+<div id="totals"></div>
+<div id="groupPages"><button id="previousGroups">&lt;</button> <span id="groupRange"></span> <button id="nextGroups">&gt;</button></div>
+<table class="summary" id="groups"></table>
+<div id="failures"></div>
+<div id="controls">
+State <select id="state"><option value="">all</option><option value="1">passed</option><option value="0">failed</option></select>
+Groups <input id="group" size="8" placeholder="3 or 2-7">
+Tag <select id="tag"><option value="">all</option></select>
+Sort <select id="sort"><option value="">test order</option><option value="desc">slowest first</option><option value="asc">fastest first</option></select>
+<span id="status"></span>
+</div>
+<div id="view"><div id="spacer"></div><div id="rows"></div></div>
+<script>
+"use strict";
+// rows are [group, test, state, durationNs, message], stored in data/chunk-N.js files that are loaded when needed;
+// the totals of the groups are [count, failed, durationNs], in data/groups-N.js files that are loaded a page at a time
+const ROW = 20, CACHE = 16;
+const TesterReport = { index: null, chunks: new Map(), waiting: new Map(), loading: new Map() };
+TesterReport.setIndex = function(index) { TesterReport.index = index; };
+TesterReport.setGroups = function(n, groups) {
+    const resolve = TesterReport.waiting.get("groups-" + n);
+    TesterReport.waiting.delete("groups-" + n);
+    if(resolve) resolve(groups);
+};
+function loadScript(key, src) {
+    return new Promise(resolve => {
+        TesterReport.waiting.set(key, resolve);
+        const script = document.createElement("script");
+        script.src = src;
+        script.onload = () => script.remove();
+        document.body.appendChild(script);
+    });
+}
+TesterReport.setChunk = function(n, rows) {
+    TesterReport.chunks.set(n, rows);
+    const resolve = TesterReport.waiting.get(n);
+    TesterReport.waiting.delete(n);
+    if(resolve) resolve(rows);
+};
+function load(n) {
+    const cached = TesterReport.chunks.get(n);
+    if(cached) {
+        TesterReport.chunks.delete(n); // move to the back, so the least recently used chunk is first
+        TesterReport.chunks.set(n, cached);
+        return Promise.resolve(cached);
+    }
+    if(TesterReport.loading.has(n)) return TesterReport.loading.get(n);
+    const promise = loadScript(n, "data/chunk-" + n + ".js").then(rows => {
+        TesterReport.loading.delete(n);
+        while(TesterReport.chunks.size > CACHE) TesterReport.chunks.delete(TesterReport.chunks.keys().next().value);
+        return rows;
+    });
+    TesterReport.loading.set(n, promise);
+    return promise;
+}
+function duration(ns) {
+    if(ns >= 1e9) return (ns / 1e9).toFixed(2) + " s";
+    if(ns >= 1e6) return (ns / 1e6).toFixed(2) + " ms";
+    if(ns >= 1e3) return (ns / 1e3).toFixed(2) + " us";
+    return ns + " ns";
+}
+function text(tag, content, cls) {
+    const element = document.createElement(tag);
+    element.textContent = content;
+    if(cls) element.className = cls;
+    return element;
+}
+let filtered = null; // null shows every row in order, otherwise the matching rows
+let scan = 0;
+function tagOf(group) { // the tag of the last run that starts at or before group
+    const runs = TesterReport.index.tags;
+    let low = 0, high = runs.length;
+    while(low < high) {
+        const middle = (low + high) >> 1;
+        if(runs[middle][0] <= group) low = middle + 1;
+        else high = middle;
+    }
+    return low > 0 ? runs[low - 1][1] : "";
+}
+function rowCount() { return filtered ? filtered.length : TesterReport.index.rows; }
+function render() {
+    const view = document.getElementById("view"), rows = document.getElementById("rows");
+    document.getElementById("spacer").style.height = rowCount() * ROW + "px";
+    const first = Math.floor(view.scrollTop / ROW), last = Math.min(rowCount(), first + Math.ceil(view.clientHeight / ROW) + 1);
+    rows.style.top = first * ROW + "px";
+    rows.textContent = "";
+    const size = TesterReport.index.chunkSize;
+    for(let i = first; i < last; i++) {
+        let row = null;
+        if(filtered) {
+            row = filtered[i];
+        }
+        else {
+            const chunk = TesterReport.chunks.get(Math.floor(i / size));
+            if(chunk) row = chunk[i % size];
+            else load(Math.floor(i / size)).then(render);
+        }
+        const line = document.createElement("div");
+        line.className = "row";
+        if(row) {
+            line.append(text("span", row[0], "g"), text("span", tagOf(row[0]), "tag"), text("span", row[1], "t"),
+                        text("span", row[2] ? "pass" : "fail", row[2] ? "s pass" : "s fail"), text("span", duration(row[3]), "d"), text("span", row[4]));
+        }
+        else {
+            line.textContent = "loading...";
+        }
+        rows.appendChild(line);
+    }
+}
+async function apply() {
+    const state = document.getElementById("state").value, tag = document.getElementById("tag").value;
+    const sort = document.getElementById("sort").value, range = document.getElementById("group").value.trim();
+    const status = document.getElementById("status");
+    const id = ++scan;
+    let low = 1, high = Infinity;
+    if(range) {
+        const parts = range.split("-").map(Number);
+        low = parts[0];
+        high = parts.length > 1 ? parts[1] : parts[0];
+    }
+    if(!state && !tag && !sort && !range) {
+        filtered = null;
+        status.textContent = "";
+        render();
+        return;
+    }
+    // only the chunks that can hold matching rows are loaded, one at a time
+    const matches = row => row[0] >= low && row[0] <= high && (!state || row[2] === Number(state)) && (!tag || tagOf(row[0]) === tag);
+    const chunks = TesterReport.index.chunks;
+    filtered = [];
+    for(let n = 0; n < chunks.length; n++) {
+        const c = chunks[n];
+        if(c.lastGroup < low || c.firstGroup > high || (state === "0" && c.failed === 0) || (state === "1" && c.failed === c.count)) continue;
+        const rows = await load(n);
+        if(id !== scan) return;
+        for(const row of rows) if(matches(row)) filtered.push(row);
+        status.textContent = "scanned " + (n + 1) + "/" + chunks.length + " files, " + filtered.length + " rows";
+        if(!sort) render();
+    }
+    if(sort) filtered.sort(sort === "desc" ? (a, b) => b[3] - a[3] : (a, b) => a[3] - b[3]);
+    render();
+}
+function summary() {
+    const index = TesterReport.index;
+    document.getElementById("totals").textContent = index.rows + " tests, " + index.passed + " passed, " + (index.rows - index.passed) + " failed";
+    showGroups(0);
+    const failures = document.getElementById("failures");
+    if(index.failures.length > 0) {
+        failures.appendChild(text("h2", "First failures"));
+        for(const f of index.failures) failures.appendChild(text("div", "Group " + f[0] + ", Test " + f[1] + ": " + f[4], "fail"));
+    }
+    const tags = document.getElementById("tag");
+    for(const tag of new Set(index.tags.map(run => run[1]).filter(t => t))) tags.appendChild(text("option", tag));
+}
+let groupPage = 0;
+async function showGroups(page) {
+    const index = TesterReport.index, pages = Math.ceil(index.groups / index.groupsPerFile);
+    if(page < 0 || page >= pages) return;
+    groupPage = page;
+    const groups = await loadScript("groups-" + page, "data/groups-" + page + ".js");
+    if(groupPage !== page) return;
+    const first = page * index.groupsPerFile + 1;
+    document.getElementById("groupRange").textContent = "groups " + first + "-" + (first + groups.length - 1) + " of " + index.groups;
+    const table = document.getElementById("groups");
+    table.textContent = "";
+    const header = document.createElement("tr");
+    for(const name of ["Group", "Tag", "Tests", "Passed", "Failed", "Total time"]) header.appendChild(text("th", name));
+    table.appendChild(header);
+    groups.forEach(([count, failed, durationNs], i) => {
+        const line = document.createElement("tr");
+        line.append(text("td", first + i), text("td", tagOf(first + i)), text("td", count), text("td", count - failed), text("td", failed, failed ? "fail" : ""), text("td", duration(durationNs)));
+        table.appendChild(line);
+    });
+}
+</script>
+<script src="data/index.js"></script>
+<script>
+summary();
+render();
+document.getElementById("view").addEventListener("scroll", render);
+for(const id of ["state", "tag", "sort", "group"]) document.getElementById(id).addEventListener("change", apply);
+document.getElementById("previousGroups").addEventListener("click", () => showGroups(groupPage - 1));
+document.getElementById("nextGroups").addEventListener("click", () => showGroups(groupPage + 1));
+</script>
+</body>
+</html>
+)TLHTML";
+
+        /**
+         * @brief Runs one test of testRangeForked or testTwoVectorForked, the way TestRange and TestTwoVector do
+         * @param expected The expected vector, empty to only check for exceptions
+         * @param index The index of the test
+         * @param label The number shown in the message
+         * @param group The group number
+         * @param call Calls the Callable
+         * @return The Result of the test
+         */
+        template<typename T1, typename Call>
+        static Result forkedTest(const std::vector<T1> &expected, int index, int label, int group, Call call) {
+            bool state = false;
+            std::string result;
+            try {
+                if constexpr (std::is_void_v<std::invoke_result_t<Call &>>) {
+                    call();
+                    result = std::string("Passed: ") + std::to_string(label);
                 }
-                catch(std::exception &e) {
-                    result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(i);
+                else if(expected.empty()) { // meaning that we are now only checking essentially if it throws an exception or not
+                    call();
+                    result = std::string("Passed: ") + std::to_string(label);
                 }
-                this->results.emplace_back(this->message + " " + result + (i < this->messages.size() ? ", " + this->messages.at(i) : ""), state, this->groupNum, i + 1);
+                else {
+                    // if expected is smaller than the number of tests, we just use the last value as expected
+                    state = call() == expected.at(std::min<unsigned long long>(expected.size() - 1, index));
+                    result = std::string(state ? "Passed: " : "Failed: ") + std::to_string(label);
+                }
+            }
+            catch(std::exception &e) {
+                result = "Exception Thrown: " + std::string(e.what()) + " on " + std::to_string(label);
             }
+            catch(...) {
+                result = "Exception Thrown: unknown exception on " + std::to_string(label);
+            }
+            return {" " + result, state, group, index + 1};
+        }
 
-            return this->results;
+
+    public:
+        Tester() = default;
+        Tester(const Tester &other) = default;
+        Tester &operator=(const Tester &other) = default;
+
+        Tester(Tester &&other) noexcept
+            : results(std::move(other.results)), timings(std::move(other.timings)), timingOptions(other.timingOptions), progress(other.progress),
+              events(other.events), tags(std::move(other.tags)), threads(other.threads), cliffOptions(other.cliffOptions) {
+            CrashHandler::Replace(&other.results, &results);
         }
 
-        template<typename Callable, typename... Args>
-        std::vector<Result> RunAll(Callable& method, Args... args) {
-            return RunAllArgs(method, args...);
+        Tester &operator=(Tester &&other) noexcept {
+            if(&other != this) {
+                results = std::move(other.results);
+                timings = std::move(other.timings);
+                timingOptions = other.timingOptions;
+                progress = other.progress;
+                events = other.events;
+                tags = std::move(other.tags);
+                threads = other.threads;
+                cliffOptions = other.cliffOptions;
+                CrashHandler::Replace(&other.results, &results);
+            }
+            return *this;
         }
 
-        template<typename Callable, typename... Args>
-        std::vector<Result> RunAll(Callable& method) {
-            return RunAllNoArgs(method);
+        ~Tester() {
+            CrashHandler::Replace(&results, nullptr);
         }
 
+        /**
+         * @brief Writes the results recorded so far to a file if a test crashes the process
+         * @param path The file, in the format of saveResults
+         * @return false if the handler could not be installed
+         *
+         * See CrashHandler. Only one Tester can have the handler at a time, the last one installed wins. The handler
+         * follows the Tester when it is moved, and stops writing results when it is destroyed.
+         */
+        bool installCrashHandler(const std::string &path) const {
+            return CrashHandler::Install(results, path);
+        }
 
-    };
+        /**
+         * @brief Sets how many threads the parallel tests (testMetamorphic and the like) use
+         * @param count The number of threads, 0 for std::thread::hardware_concurrency
+         */
+        void setThreads(unsigned int count) {
+            threads = count;
+        }
 
-   /**
-    * @brief A tester container that stores information about ran tests
-    *
-    * Allows the testing of various methods and then those results to be stored into one
-    * vector of results, rather than having multiple different tests that might make testing
-    * simpler objects harder.
-    */
-    class Tester {
-    private:
-        std::vector<std::vector<Result>> results;
+        /**
+         * @brief Sets the ProgressReporter that counts the tests of every following testRange and testTwoVectorMethod
+         * @param reporter The reporter, which has to outlive the tests, nullptr to stop reporting
+         */
+        void setProgress(ProgressReporter *reporter) {
+            progress = reporter;
+        }
 
-    public:
-        Tester() = default;
-        ~Tester() = default;
+        /**
+         * @brief Sets the EventPublisher that the tests of every following testRange and testTwoVectorMethod are published to
+         * @param publisher The publisher, which has to outlive the tests, nullptr to stop publishing
+         */
+        void setEvents(EventPublisher *publisher) {
+            events = publisher;
+        }
 
         /**
          * @brief Tests one comparison using operator==. Will automatically put into results.
@@ -676,102 +4438,790 @@ namespace TesterLib {
          */
         template<typename T1, typename Callable, typename... Args>
         std::vector<Result> testRange(int from, int to, std::vector<T1> expected, std::string message, std::vector<std::string> messages, Callable &method, Args... args) {
-            std::vector<Result> testResults = TestRange<T1>(from, to, expected, message, messages, static_cast<int>(results.size() + 1)).RunAll(method, args...);
+            TestRange<T1> test(from, to, expected, message, messages, static_cast<int>(results.size() + 1));
+            watch(test, to - from + 1);
+            std::vector<Result> testResults = test.RunAll(method, args...);
+            detectCliffs(testResults, from, to, method, args...);
+            results.reserve(testResults.size());
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+        template<typename Callable, typename... Args>
+        std::vector<Result> testRange(int from, int to, Callable &method, Args... args) {
+            return testRange(from, to, std::vector<int>{}, "", {}, method, args...);
+        }
+        template<typename T1, typename Callable, typename... Args>
+        std::vector<Result> testRange(int from, int to, std::vector<T1> expected, Callable &method, Args... args) {
+            return testRange(from, to, expected, "", {}, method, args...);
+        }
+        template<typename Callable, typename... Args>
+        std::vector<Result> testRange(int from, int to, std::string message, std::vector<std::string> messages,  Callable &method, Args... args) {
+            return testRange(from, to, std::vector<int>{}, message, messages, method, args...);
+        }
+
+        /**
+         * @brief Function version of the class TestRange
+         * @tparam T1 The return type of the Callable
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         * @param method A Callable
+         * @param message A message to append to all results
+         * @param messages A message to append to nth result
+         * @return A vector of Results
+         */
+        template<typename T1, typename Callable, typename... Args>
+        std::vector<Result> testRange(int from, int to, std::vector<T1> expected, Callable &method, std::string message = "", std::vector<std::string> messages = {}) {
+            TestRange<T1> test(from, to, expected, message, messages, static_cast<int>(results.size() + 1));
+            watch(test, to - from + 1);
+            std::vector<Result> testResults = test.RunAll(method);
+            detectCliffs(testResults, from, to, method);
+            results.reserve(testResults.size());
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+
+
+
+        /**
+         * @brief Function version of the class TestTwoVector
+         * @tparam T1 Type of the inputs
+         * @tparam U2 Type of the expected
+         * @tparam Callable Any function, method or lambda tha can be called upon
+         * @tparam Args The arguments for Callable
+         * @param inputs Inputs for each test
+         * @param expected Expected output for each input test
+         * @param message A message appended to all results
+         * @param method A Callable
+         * @param args An Args for method's arguments
+         * @return A vector of Results
+         */
+        template<typename T1, typename U2, typename Callable, typename... Args>
+        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, std::string message, std::vector<std::string> messages, Callable &method, Args... args) {
+            TestTwoVector<T1, U2> test(inputs, expected, message, messages, static_cast<int>(results.size() + 1));
+            watch(test, static_cast<long long>(inputs.size()));
+            std::vector<Result> testResults = test.RunAll(method, args...);
+            results.reserve(testResults.size());
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+        // we have to do a lot of copy-pasting due to the fact that we can't simply have default parameters here
+        // also we cannot use just messages or just message because then the compiler infers it as Callable, which we do not want
+        // in the event that you just want message or messages, make message = "" or messages = {}
+        template<typename T1, typename U2, typename Callable, typename... Args> // no message, no messages
+        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, Callable &method, Args... args) {
+            return testTwoVectorMethod(inputs, expected, "", {}, method, args...);
+        }
+        template<typename T1, typename Callable, typename... Args> // no message, no messages, no expected
+        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, Callable &method, Args... args) {
+            return testTwoVectorMethod(inputs, std::vector<T1>{}, "", {}, method, args...);
+        }
+
+        // now we have to make the same thing but except this time for no arguments
+        // but this time due to the lack of a packed argument, we can use default arguments!
+        /**
+         * @brief Function version of the class TestTwoVector
+         * @tparam T1 Type of the inputs
+         * @tparam U2 Type of the expected
+         * @tparam Callable Any function, method or lambda tha can be called upon
+         * @param inputs Inputs for each test
+         * @param method A Callable
+         * @param expected *optional* Expected output for each input test
+         * @param message *optional* A message appended to all results
+         * @param messages *optional* A message appended to nth result
+         * @return A vector of Results
+         */
+        template<typename T1, typename U2, typename Callable>
+        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, Callable &method, std::vector<U2> expected = {}, std::string message = "", std::vector<std::string> messages = {}) {
+            TestTwoVector<T1, U2> test(inputs, expected, message, messages, static_cast<int>(results.size() + 1));
+            watch(test, static_cast<long long>(inputs.size()));
+            std::vector<Result> testResults = test.RunAll(method);
             results.reserve(testResults.size());
             results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+
+
+
+        /**
+         * @brief Like testRange, but the progress is saved to a Checkpoint and finished chunks are skipped on resume
+         * @tparam T1 The return type of the Callable
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         * @param expected Expected output for each test, empty to only check for exceptions
+         * @param checkpoint The Checkpoint to record to and resume from
+         * @param method A Callable
+         * @param args An Args for method's arguments
+         * @return A vector of Results, tests of resumed chunks are restored from the checkpoint
+         */
+        template<typename T1, typename Callable, typename... Args>
+        std::vector<Result> testRangeCheckpointed(int from, int to, std::vector<T1> expected, Checkpoint &checkpoint, Callable &method, Args... args) {
+            int group = static_cast<int>(results.size() + 1);
+            std::vector<Result> testResults;
+            testResults.reserve(static_cast<std::size_t>(std::max(0, to - from + 1)));
+            for(long long first = from; first <= to; first += checkpoint.ChunkSize()) {
+                long long last = std::min<long long>(to, first + checkpoint.ChunkSize() - 1);
+                auto offset = static_cast<int>(first - from);
+                if(checkpoint.Completed(group, first)) {
+                    const std::vector<Result> &failed = checkpoint.Failures(group, first);
+                    auto next = failed.begin();
+                    for(long long i = first; i <= last; i++) {
+                        int testNum = static_cast<int>(i - from) + 1;
+                        if(next != failed.end() && next->testNum == testNum) {
+                            testResults.push_back(*next++);
+                        }
+                        else {
+                            testResults.emplace_back(" Passed: " + std::to_string(i) + " (resumed)", true, group, testNum);
+                        }
+                    }
+                    continue;
+                }
+                // the expected values of the chunk, with the last value standing in past the end like TestRange does
+                std::vector<T1> chunkExpected;
+                for(long long i = first; i <= last && !expected.empty(); i++) {
+                    chunkExpected.push_back(expected[std::min<std::size_t>(expected.size() - 1, static_cast<std::size_t>(i - from))]);
+                }
+                TestRange<T1> test(static_cast<int>(first), static_cast<int>(last), chunkExpected, "", {}, group);
+                watch(test, last - first + 1);
+                std::vector<Result> chunkResults = test.RunAll(method, args...);
+                for(Result &result : chunkResults) {
+                    result.testNum += offset;
+                }
+                checkpoint.Complete(group, first, last, chunkResults);
+                std::move(chunkResults.begin(), chunkResults.end(), std::back_inserter(testResults));
+            }
+            checkpoint.Save();
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+
+        /**
+         * @brief Like testRange, but every batch of tests runs in a fork()ed copy of a ForkFixture
+         * @tparam F The type of the fixture
+         * @tparam T1 The return type of the Callable
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         * @param expected Expected output for each test, empty to only check for exceptions
+         * @param fixture The fixture, every batch starts from the state it was built in
+         * @param batchSize How many tests share one copy of the fixture, 1 for a pristine fixture per test
+         * @param method A Callable, called as method(F &fixture, int i, args...)
+         * @param args An Args for method's arguments
+         * @return A vector of Results
+         */
+        template<typename F, typename T1, typename Callable, typename... Args>
+        std::vector<Result> testRangeForked(int from, int to, std::vector<T1> expected, ForkFixture<F> &fixture, unsigned int batchSize, Callable &method, Args... args) {
+            int group = static_cast<int>(results.size() + 1);
+            std::vector<Result> testResults = fixture.RunBatches(std::max(0, to - from + 1), batchSize, group, [&](int index, F &copy) {
+                return forkedTest(expected, index, from + index, group, [&] { return std::invoke(method, copy, from + index, args...); });
+            });
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+
+        /**
+         * @brief Like testTwoVectorMethod, but every batch of tests runs in a fork()ed copy of a ForkFixture
+         * @tparam F The type of the fixture
+         * @tparam T1 Type of the inputs
+         * @tparam U2 Type of the expected
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param inputs Inputs for each test
+         * @param expected Expected output for each input test, empty to only check for exceptions
+         * @param fixture The fixture, every batch starts from the state it was built in
+         * @param batchSize How many tests share one copy of the fixture, 1 for a pristine fixture per test
+         * @param method A Callable, called as method(F &fixture, T1 input, args...)
+         * @param args An Args for method's arguments
+         * @return A vector of Results
+         */
+        template<typename F, typename T1, typename U2, typename Callable, typename... Args>
+        std::vector<Result> testTwoVectorForked(std::vector<T1> inputs, std::vector<U2> expected, ForkFixture<F> &fixture, unsigned int batchSize, Callable &method, Args... args) {
+            int group = static_cast<int>(results.size() + 1);
+            std::vector<Result> testResults = fixture.RunBatches(static_cast<int>(inputs.size()), batchSize, group, [&](int index, F &copy) {
+                return forkedTest(expected, index, index, group, [&] { return std::invoke(method, copy, inputs[index], args...); });
+            });
+            results.emplace_back(testResults);
+            summarize(testResults);
+            return testResults;
+        }
+
+        /**
+         * @brief Tests a relation between the outputs of a Callable for a range, instead of expected outputs
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Transform A Callable that makes a follow-up input from a source input
+         * @tparam Relation A Callable returning bool, see below
+         * @tparam Args The arguments for Callable
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         * @param method A Callable, called as method(input, args...)
+         * @param transform Makes the follow-up input, e.g. [](int x) { return 2 * x; }
+         * @param relation Called as relation(f(x), f(transform(x))), or relation(x, f(x), transform(x), f(transform(x)))
+         * @param args An Args for method's arguments
+         * @return The violations, with both inputs and outputs, followed by one summary Result
+         *
+         * The inputs are checked in parallel batches, on as many threads as setThreads says, so method, transform and
+         * relation have to be safe to call from several threads.
+         */
+        template<typename Callable, typename Transform, typename Relation, typename... Args>
+        std::vector<Result> testMetamorphic(int from, int to, Callable &method, Transform transform, Relation relation, Args... args) {
+            auto count = static_cast<std::size_t>(std::max(0LL, static_cast<long long>(to) - from + 1));
+            return metamorphic(count, [from](std::size_t i) { return static_cast<int>(from + static_cast<long long>(i)); }, method, transform, relation, args...);
+        }
+
+        /**
+         * @brief Tests a relation between the outputs of a Callable for a list of inputs, see the range version
+         * @param inputs The source inputs
+         */
+        template<typename T1, typename Callable, typename Transform, typename Relation, typename... Args>
+        std::vector<Result> testMetamorphic(const std::vector<T1> &inputs, Callable &method, Transform transform, Relation relation, Args... args) {
+            return metamorphic(inputs.size(), [&inputs](std::size_t i) -> const T1 & { return inputs[i]; }, method, transform, relation, args...);
+        }
+
+        /**
+         * @brief Tests a stateful system against a simple reference model with random sequences of operations
+         * @tparam Factory A Callable that makes a new system under test
+         * @tparam System The type of the system, what factory returns
+         * @tparam Model The type of the reference model, copied for every sequence
+         * @tparam Observation What every operation returns, compared with operator==
+         * @param factory Makes a new system for every sequence (and every shrinking attempt)
+         * @param model The reference model in its starting state
+         * @param generators Make the operations, one is picked at random for every step
+         * @param sequences How many random sequences to run
+         * @param length How many operations every sequence has
+         * @param seed The seed of the sequences, the same seed runs the same sequences
+         * @return One failing Result per sequence where the system and the model disagreed, followed by a summary Result
+         *
+         * The sequences run in parallel (see setThreads), so factory has to be safe to call from several threads and
+         * the systems must not share state. After every step the observations of the system and the model are
+         * compared. A failing sequence is shrunk: steps are removed, in halves and then one at a time, for as long as
+         * the sequence still fails, and the smallest sequence found is reported as the reproduction.
+         */
+        template<typename Factory, typename System, typename Model, typename Observation>
+        std::vector<Result> testModel(Factory factory, const Model &model, const std::vector<std::function<ModelOperation<System, Model, Observation>(std::mt19937_64 &)>> &generators,
+                                      std::size_t sequences = 1000, std::size_t length = 50, std::uint64_t seed = 0x7e57) {
+            using Operation = ModelOperation<System, Model, Observation>;
+            int group = static_cast<int>(results.size() + 1);
+            std::vector<std::optional<Result>> failures(sequences);
+            if(!generators.empty()) {
+                parallelFor(sequences, threads, 1, [&](std::size_t begin, std::size_t end) {
+                    for(std::size_t index = begin; index < end; index++) {
+                        std::seed_seq seeds{seed, static_cast<std::uint64_t>(index)};
+                        std::mt19937_64 random(seeds);
+                        std::vector<Operation> operations;
+                        operations.reserve(length);
+                        for(std::size_t step = 0; step < length; step++) {
+                            operations.push_back(generators[random() % generators.size()](random));
+                        }
+                        std::vector<const Operation *> sequence;
+                        for(const Operation &operation : operations) {
+                            sequence.push_back(&operation);
+                        }
+                        std::string detail;
+                        long long failedAt = runModelSequence(factory, model, sequence, detail);
+                        if(failedAt < 0) {
+                            continue;
+                        }
+                        sequence.resize(static_cast<std::size_t>(failedAt) + 1); // the steps after the failure do not matter
+                        // remove chunks of steps, halving the chunk size, as long as the sequence keeps failing
+                        for(std::size_t chunk = std::max<std::size_t>(1, sequence.size() / 2); ; chunk /= 2) {
+                            for(std::size_t start = 0; start < sequence.size() && sequence.size() > 1;) {
+                                std::vector<const Operation *> smaller(sequence.begin(), sequence.begin() + static_cast<std::ptrdiff_t>(start));
+                                smaller.insert(smaller.end(), sequence.begin() + static_cast<std::ptrdiff_t>(std::min(sequence.size(), start + chunk)), sequence.end());
+                                std::string smallerDetail;
+                                long long smallerAt = runModelSequence(factory, model, smaller, smallerDetail);
+                                if(smallerAt >= 0) {
+                                    smaller.resize(static_cast<std::size_t>(smallerAt) + 1);
+                                    sequence = std::move(smaller);
+                                    detail = std::move(smallerDetail);
+                                }
+                                else {
+                                    start += chunk;
+                                }
+                            }
+                            if(chunk == 1) {
+                                break;
+                            }
+                        }
+                        std::string reproduction;
+                        for(const Operation *operation : sequence) {
+                            reproduction += (reproduction.empty() ? "" : "; ") + operation->description;
+                        }
+                        failures[index] = Result(" Failed: sequence " + std::to_string(index + 1) + " diverged after " + std::to_string(sequence.size())
+                                                 + " steps (shrunk from " + std::to_string(failedAt + 1) + "): " + reproduction + " -> " + detail,
+                                                 false, group, static_cast<int>(index + 1));
+                    }
+                });
+            }
+            std::vector<Result> testResults;
+            for(std::optional<Result> &failure : failures) {
+                if(failure) {
+                    testResults.push_back(std::move(*failure));
+                }
+            }
+            std::size_t failed = testResults.size();
+            testResults.emplace_back(std::string(" ") + (failed == 0 ? "Passed" : "Failed") + ": " + std::to_string(sequences - failed) + "/"
+                                     + std::to_string(sequences) + " sequences of " + std::to_string(length) + " operations matched the model",
+                                     failed == 0, group, static_cast<int>(sequences + 1));
+            results.emplace_back(testResults);
             return testResults;
         }
-        template<typename Callable, typename... Args>
-        std::vector<Result> testRange(int from, int to, Callable &method, Args... args) {
-            return testRange(from, to, std::vector<int>{}, "", {}, method, args...);
+
+        /**
+         * @brief Tests that a randomized Callable picks buckets with the expected probabilities, with a chi-square test
+         * @tparam Sampler A Callable returning a bucket in [0, expected.size()), taking a std::mt19937_64 & or nothing
+         * @param sampler Draws one sample
+         * @param samples How many samples to draw
+         * @param expected The expected probability (or weight) of every bucket
+         * @param alpha The test fails if the p-value is smaller
+         * @param seed The seed of the random number generators passed to sampler
+         * @return A Result with the statistic and the p-value
+         *
+         * Samples are drawn in parallel batches, each with its own histogram and its own std::mt19937_64 seeded from
+         * seed and the batch, so the same seed draws the same samples for any number of threads. A sampler that takes
+         * no generator has to be safe to call from several threads. Samples outside of the buckets fail the test.
+         */
+        template<typename Sampler>
+        Result testDistribution(Sampler sampler, std::size_t samples, const std::vector<double> &expected, double alpha = 0.001, std::uint64_t seed = 0x7e57) {
+            std::vector<unsigned long long> histogram(expected.size());
+            unsigned long long outside = 0;
+            std::mutex merge;
+            try {
+                parallelFor(samples, threads, 1 << 16, [&](std::size_t begin, std::size_t end) {
+                    std::seed_seq seeds{seed, static_cast<std::uint64_t>(begin)};
+                    std::mt19937_64 random(seeds);
+                    std::vector<unsigned long long> local(expected.size());
+                    unsigned long long localOutside = 0;
+                    for(std::size_t i = begin; i < end; i++) {
+                        auto bucket = static_cast<long long>(drawSample(sampler, random));
+                        if(bucket < 0 || bucket >= static_cast<long long>(local.size())) {
+                            localOutside++;
+                        }
+                        else {
+                            local[static_cast<std::size_t>(bucket)]++;
+                        }
+                    }
+                    std::lock_guard<std::mutex> guard(merge);
+                    std::transform(histogram.begin(), histogram.end(), local.begin(), histogram.begin(), std::plus<>());
+                    outside += localOutside;
+                });
+            }
+            catch(std::exception &e) {
+                return distributionResult(false, "Exception Thrown: " + std::string(e.what()), 0, alpha);
+            }
+            double total = std::accumulate(expected.begin(), expected.end(), 0.0);
+            double statistic = 0;
+            int buckets = 0;
+            for(std::size_t b = 0; b < expected.size(); b++) {
+                double wanted = static_cast<double>(samples) * expected[b] / total;
+                if(wanted > 0) {
+                    statistic += (histogram[b] - wanted) * (histogram[b] - wanted) / wanted;
+                    buckets++;
+                }
+                else if(histogram[b] > 0) {
+                    outside += histogram[b]; // a bucket that should never be picked
+                }
+            }
+            double pValue = outside > 0 ? 0 : chiSquarePValue(statistic, buckets - 1);
+            std::ostringstream details;
+            details << "chi-square " << std::setprecision(6) << statistic << " with " << buckets - 1 << " degrees of freedom over " << samples << " samples";
+            if(outside > 0) {
+                details << ", " << outside << " samples in no expected bucket";
+            }
+            return distributionResult(pValue >= alpha, details.str(), pValue, alpha);
         }
-        template<typename T1, typename Callable, typename... Args>
-        std::vector<Result> testRange(int from, int to, std::vector<T1> expected, Callable &method, Args... args) {
-            return testRange(from, to, expected, "", {}, method, args...);
+
+        /**
+         * @brief Tests that a randomized Callable follows a continuous distribution, with a Kolmogorov-Smirnov test
+         * @tparam Sampler A Callable returning a number, taking a std::mt19937_64 & or nothing
+         * @tparam Cdf A Callable that takes a double and returns the expected probability of a smaller value
+         * @param sampler Draws one sample
+         * @param samples How many samples to draw, they are all kept and sorted
+         * @param cdf The expected cumulative distribution function
+         * @param alpha The test fails if the p-value is smaller
+         * @param seed The seed of the random number generators passed to sampler
+         * @return A Result with the largest distance and the p-value
+         */
+        template<typename Sampler, typename Cdf> requires std::is_invocable_r_v<double, Cdf &, double>
+        Result testDistribution(Sampler sampler, std::size_t samples, Cdf cdf, double alpha = 0.001, std::uint64_t seed = 0x7e57) {
+            std::vector<double> drawn(samples);
+            try {
+                parallelFor(samples, threads, 1 << 16, [&](std::size_t begin, std::size_t end) {
+                    std::seed_seq seeds{seed, static_cast<std::uint64_t>(begin)};
+                    std::mt19937_64 random(seeds);
+                    for(std::size_t i = begin; i < end; i++) {
+                        drawn[i] = static_cast<double>(drawSample(sampler, random));
+                    }
+                });
+            }
+            catch(std::exception &e) {
+                return distributionResult(false, "Exception Thrown: " + std::string(e.what()), 0, alpha);
+            }
+            std::sort(drawn.begin(), drawn.end());
+            double distance = 0;
+            for(std::size_t i = 0; i < samples; i++) {
+                double expectedAt = std::invoke(cdf, drawn[i]);
+                distance = std::max({distance, static_cast<double>(i + 1) / samples - expectedAt, expectedAt - static_cast<double>(i) / samples});
+            }
+            double pValue = samples == 0 ? 1 : kolmogorovPValue(distance, samples);
+            std::ostringstream details;
+            details << "Kolmogorov-Smirnov distance " << std::setprecision(6) << distance << " over " << samples << " samples";
+            return distributionResult(pValue >= alpha, details.str(), pValue, alpha);
         }
-        template<typename Callable, typename... Args>
-        std::vector<Result> testRange(int from, int to, std::string message, std::vector<std::string> messages,  Callable &method, Args... args) {
-            return testRange(from, to, std::vector<int>{}, message, messages, method, args...);
+
+        /**
+         * @brief Tests that flipping any input bit of a hash flips every output bit half of the time
+         * @tparam Hash A Callable taking a std::uint64_t and returning an unsigned integer
+         * @param hash The hash function
+         * @param samples How many random inputs to flip every bit of
+         * @param alpha The test fails if the p-value is smaller
+         * @param inputBits How many of the low input bits to flip
+         * @param seed The seed of the random inputs
+         * @return A Result with the chi-square statistic over every (input bit, output bit) pair, the worst bias and the p-value
+         */
+        template<typename Hash>
+        Result testAvalanche(Hash hash, std::size_t samples, double alpha = 0.001, unsigned int inputBits = 64, std::uint64_t seed = 0x7e57) {
+            using Output = std::decay_t<std::invoke_result_t<Hash &, std::uint64_t>>;
+            static_assert(std::is_unsigned_v<Output>, "testAvalanche needs a hash that returns an unsigned integer");
+            constexpr unsigned int outputBits = std::numeric_limits<Output>::digits;
+            inputBits = std::clamp(inputBits, 1u, 64u);
+            std::vector<unsigned long long> flips(static_cast<std::size_t>(inputBits) * outputBits);
+            std::mutex merge;
+            try {
+                parallelFor(samples, threads, 1 << 12, [&](std::size_t begin, std::size_t end) {
+                    std::seed_seq seeds{seed, static_cast<std::uint64_t>(begin)};
+                    std::mt19937_64 random(seeds);
+                    std::vector<unsigned long long> local(flips.size());
+                    for(std::size_t i = begin; i < end; i++) {
+                        std::uint64_t input = random();
+                        Output original = std::invoke(hash, input);
+                        for(unsigned int in = 0; in < inputBits; in++) {
+                            Output changed = original ^ std::invoke(hash, input ^ (std::uint64_t{1} << in));
+                            unsigned long long *row = local.data() + static_cast<std::size_t>(in) * outputBits;
+                            for(unsigned int out = 0; out < outputBits; out++) {
+                                row[out] += (changed >> out) & 1u;
+                            }
+                        }
+                    }
+                    std::lock_guard<std::mutex> guard(merge);
+                    std::transform(flips.begin(), flips.end(), local.begin(), flips.begin(), std::plus<>());
+                });
+            }
+            catch(std::exception &e) {
+                return distributionResult(false, "Exception Thrown: " + std::string(e.what()), 0, alpha);
+            }
+            double half = static_cast<double>(samples) / 2;
+            double statistic = 0;
+            double worst = 0;
+            for(unsigned long long count : flips) {
+                statistic += (count - half) * (count - half) / (half / 2);
+                worst = std::max(worst, std::abs(count - half) / std::max(1.0, static_cast<double>(samples)));
+            }
+            double pValue = samples == 0 ? 1 : chiSquarePValue(statistic, static_cast<double>(flips.size()));
+            std::ostringstream details;
+            details << "avalanche chi-square " << std::setprecision(6) << statistic << " over " << flips.size() << " bit pairs and " << samples
+                    << " samples, worst bias " << worst;
+            return distributionResult(pValue >= alpha, details.str(), pValue, alpha);
         }
 
         /**
-         * @brief Function version of the class TestRange
-         * @tparam T1 The return type of the Callable
+         * @brief Tests how the peak heap bytes of a Callable grow with its input size
          * @tparam Callable Any function, method or lambda that can be called upon
          * @tparam Args The arguments for Callable
-         * @param from Starting range (inclusive)
-         * @param to Ending range (inclusive)
+         * @param sizes The input sizes, at least three different ones, called as method(size, args...)
+         * @param bound The largest growth that passes
          * @param method A Callable
-         * @param message A message to append to all results
-         * @param messages A message to append to nth result
-         * @return A vector of Results
+         * @param args An Args
+         * @return A Result with the fitted growth, its coefficients and the peak at every size
+         *
+         * Needs AllocationTracker, so TESTER_TRACK_ALLOCATIONS has to be defined in one translation unit. The peak
+         * is measured above the bytes in use before the call, including what the result holds, so allocations of
+         * other threads during the call are counted too. Peak bytes are fitted to a + b * g(n) for every Complexity
+         * by least squares; the simplest growth whose error is within 10% of the best fit is reported.
          */
-        template<typename T1, typename Callable, typename... Args>
-        std::vector<Result> testRange(int from, int to, std::vector<T1> expected, Callable &method, std::string message = "", std::vector<std::string> messages = {}) {
-            std::vector<Result> testResults = TestRange<T1>(from, to, expected, message, messages, static_cast<int>(results.size() + 1)).RunAll(method);
-            results.reserve(testResults.size());
-            results.emplace_back(testResults);
-            return testResults;
+        template<typename Callable, typename... Args>
+        Result testMemoryScaling(const std::vector<int> &sizes, Complexity bound, Callable &method, Args... args) {
+            auto finish = [this](bool passed, const std::string &text) {
+                Result result((passed ? " Passed: " : " Failed: ") + text, passed, static_cast<int>(results.size() + 1), 1);
+                results.emplace_back(std::vector<Result>{result});
+                return result;
+            };
+            if(!AllocationTracker::Installed()) {
+                return finish(false, "heap allocations are not tracked, define TESTER_TRACK_ALLOCATIONS before including tester.h in one source file");
+            }
+            if(std::set<int>(sizes.begin(), sizes.end()).size() < 3) {
+                return finish(false, "testMemoryScaling needs at least three different sizes");
+            }
+            std::vector<double> peaks;
+            try {
+                for(int size : sizes) {
+                    long long least = std::numeric_limits<long long>::max();
+                    for(int r = 0; r < 3; r++) { // the smallest of three peaks, so lazy one-time allocations do not count
+                        long long before = AllocationTracker::CurrentBytes();
+                        AllocationTracker::ResetPeak();
+                        if constexpr(std::is_void_v<std::invoke_result_t<Callable &, int, Args &...>>) {
+                            std::invoke(method, size, args...);
+                        }
+                        else {
+                            auto kept = std::invoke(method, size, args...);
+                            doNotOptimize(kept);
+                        }
+                        least = std::min(least, AllocationTracker::PeakBytes() - before);
+                    }
+                    peaks.push_back(static_cast<double>(std::max(0LL, least)));
+                }
+            }
+            catch(std::exception &e) {
+                return finish(false, "Exception Thrown: " + std::string(e.what()));
+            }
+            auto growth = [](Complexity complexity, double n) {
+                switch(complexity) {
+                    case Complexity::Constant:
+                        return 0.0;
+                    case Complexity::Linear:
+                        return n;
+                    case Complexity::Linearithmic:
+                        return n * std::log2(std::max(n, 1.0));
+                    case Complexity::Quadratic:
+                        return n * n;
+                }
+                return 0.0;
+            };
+            double meanPeak = std::accumulate(peaks.begin(), peaks.end(), 0.0) / static_cast<double>(peaks.size());
+            struct Fit {
+                Complexity complexity;
+                double intercept, slope, error;
+            };
+            std::vector<Fit> fits;
+            for(Complexity complexity : {Complexity::Constant, Complexity::Linear, Complexity::Linearithmic, Complexity::Quadratic}) {
+                double meanG = 0;
+                for(int size : sizes) {
+                    meanG += growth(complexity, size);
+                }
+                meanG /= static_cast<double>(sizes.size());
+                double covariance = 0, variance = 0;
+                for(std::size_t i = 0; i < sizes.size(); i++) {
+                    double g = growth(complexity, sizes[i]) - meanG;
+                    covariance += g * (peaks[i] - meanPeak);
+                    variance += g * g;
+                }
+                double slope = variance > 0 ? std::max(0.0, covariance / variance) : 0;
+                double intercept = meanPeak - slope * meanG;
+                double squares = 0;
+                for(std::size_t i = 0; i < sizes.size(); i++) {
+                    double residual = peaks[i] - intercept - slope * growth(complexity, sizes[i]);
+                    squares += residual * residual;
+                }
+                fits.push_back({complexity, intercept, slope, std::sqrt(squares / static_cast<double>(sizes.size())) / std::max(meanPeak, 1.0)});
+            }
+            double bestError = std::min_element(fits.begin(), fits.end(), [](const Fit &a, const Fit &b) { return a.error < b.error; })->error;
+            const Fit &fit = *std::find_if(fits.begin(), fits.end(), [bestError](const Fit &f) { return f.error <= bestError * 1.1 + 0.01; });
+            bool passed = fit.complexity <= bound;
+            std::ostringstream text;
+            text << "peak heap bytes grow as " << toString(fit.complexity) << " (bound " << toString(bound) << "), " << std::setprecision(4);
+            if(fit.complexity != Complexity::Constant) {
+                text << fit.slope << " * " << (fit.complexity == Complexity::Linear ? "n" : fit.complexity == Complexity::Linearithmic ? "n log n" : "n^2") << " + ";
+            }
+            text << fit.intercept << ", fit error " << std::setprecision(3) << fit.error * 100 << "%:";
+            for(std::size_t i = 0; i < sizes.size(); i++) {
+                text << (i == 0 ? " " : ", ") << sizes[i] << " -> " << static_cast<long long>(peaks[i]);
+            }
+            return finish(passed, text.str());
         }
 
-
-
         /**
-         * @brief Function version of the class TestTwoVector
-         * @tparam T1 Type of the inputs
-         * @tparam U2 Type of the expected
-         * @tparam Callable Any function, method or lambda tha can be called upon
+         * @brief Makes every heap allocation of a Callable fail in turn, and checks that it fails cleanly each time
+         * @tparam Callable Any function, method or lambda that can be called upon
          * @tparam Args The arguments for Callable
-         * @param inputs Inputs for each test
-         * @param expected Expected output for each input test
-         * @param message A message appended to all results
          * @param method A Callable
-         * @param args An Args for method's arguments
-         * @return A vector of Results
+         * @param args An Args
+         * @return A failing Result for every allocation that was not handled cleanly, followed by a summary Result
+         *
+         * Needs AllocationTracker, so TESTER_TRACK_ALLOCATIONS has to be defined in one translation unit. After a warm-up
+         * call, a clean call counts the allocations, then for every N up to that count the call is repeated with the Nth allocation failing:
+         * operator new throws std::bad_alloc and the nothrow forms return nullptr. A run is clean if it returns or
+         * throws, and the heap is back to the bytes in use before it. Every run is a fork()ed child process of a
+         * ForkFixture, as many at once as setThreads allows, so a crash is reported for its N instead of ending the
+         * test program. Where fork is not available the runs are made in this process.
          */
-        template<typename T1, typename U2, typename Callable, typename... Args>
-        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, std::string message, std::vector<std::string> messages, Callable &method, Args... args) {
-            std::vector<Result> testResults = TestTwoVector<T1, U2>(inputs, expected, message, messages, static_cast<int>(results.size() + 1)).RunAll(method, args...);
-            results.reserve(testResults.size());
-            results.emplace_back(testResults);
-            return testResults;
-        }
-        // we have to do a lot of copy-pasting due to the fact that we can't simply have default parameters here
-        // also we cannot use just messages or just message because then the compiler infers it as Callable, which we do not want
-        // in the event that you just want message or messages, make message = "" or messages = {}
-        template<typename T1, typename U2, typename Callable, typename... Args> // no message, no messages
-        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, Callable &method, Args... args) {
-            return testTwoVectorMethod(inputs, expected, "", {}, method, args...);
-        }
-        template<typename T1, typename Callable, typename... Args> // no message, no messages, no expected
-        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, Callable &method, Args... args) {
-            return testTwoVectorMethod(inputs, std::vector<T1>{}, "", {}, method, args...);
+        template<typename Callable, typename... Args>
+        std::vector<Result> testAllocationFailures(Callable &method, Args... args) {
+            int group = static_cast<int>(results.size() + 1);
+            auto finish = [&](std::vector<Result> testResults) {
+                results.emplace_back(testResults);
+                return testResults;
+            };
+            if(!AllocationTracker::Installed()) {
+                return finish({Result(" Failed: heap allocations are not tracked, define TESTER_TRACK_ALLOCATIONS before including tester.h in one source file", false, group, 1)});
+            }
+            auto run = [&]() {
+                if constexpr(std::is_void_v<std::invoke_result_t<Callable &, Args &...>>) {
+                    std::invoke(method, args...);
+                }
+                else {
+                    doNotOptimize(std::invoke(method, args...));
+                }
+            };
+            unsigned long long allocationsBefore = 0;
+            long long bytesBefore = 0;
+            try {
+                run(); // once to warm up lazy initialisation, which would count as a leak
+                allocationsBefore = AllocationTracker::Allocations();
+                bytesBefore = AllocationTracker::CurrentBytes();
+                run();
+            }
+            catch(std::exception &e) {
+                return finish({Result(" Failed: the clean run threw: " + std::string(e.what()), false, group, 1)});
+            }
+            catch(...) {
+                return finish({Result(" Failed: the clean run threw a non std::exception", false, group, 1)});
+            }
+            auto total = static_cast<int>(std::min<unsigned long long>(AllocationTracker::Allocations() - allocationsBefore, std::numeric_limits<int>::max() - 1));
+            long long cleanLeak = AllocationTracker::CurrentBytes() - bytesBefore;
+            ForkFixture<char> processes([] { return '\0'; }, threads);
+            std::vector<Result> runs = processes.RunBatches(total, 1, group, [&](int i, char &) {
+                char outcome[256] = "returned"; // no std::string until the leak is measured
+                long long before = AllocationTracker::CurrentBytes();
+                AllocationTracker::FailAt(i + 1);
+                try {
+                    run();
+                }
+                catch(std::bad_alloc &) {
+                    std::snprintf(outcome, sizeof(outcome), "threw std::bad_alloc");
+                }
+                catch(std::exception &e) {
+                    std::snprintf(outcome, sizeof(outcome), "threw: %s", e.what());
+                }
+                catch(...) {
+                    std::snprintf(outcome, sizeof(outcome), "threw a non std::exception");
+                }
+                bool injected = AllocationTracker::FailsIn() == 0;
+                AllocationTracker::FailAt(0);
+                long long leaked = AllocationTracker::CurrentBytes() - before;
+                std::string text = "allocation " + std::to_string(i + 1) + " of " + std::to_string(total) + " failed, " + outcome;
+                if(!injected) {
+                    text = "allocation " + std::to_string(i + 1) + " of " + std::to_string(total) + " was never made, the allocations are not deterministic";
+                }
+                else if(leaked > 0) {
+                    text += ", leaked " + std::to_string(leaked) + " bytes";
+                }
+                bool state = injected && leaked <= 0;
+                return Result((state ? " Passed: " : " Failed: ") + text, state, group, i + 1);
+            });
+            std::vector<Result> testResults = filter(runs, [](const Result &result) { return !result.state; });
+            std::ostringstream summary;
+            bool passed = testResults.empty() && cleanLeak <= 0;
+            summary << (passed ? " Passed: " : " Failed: ") << total - static_cast<int>(testResults.size()) << "/" << total << " injected allocation failures were handled cleanly";
+            if(cleanLeak > 0) {
+                summary << ", the clean run leaked " << cleanLeak << " bytes";
+            }
+            testResults.emplace_back(summary.str(), passed, group, total + 1);
+            return finish(testResults);
         }
 
-        // now we have to make the same thing but except this time for no arguments
-        // but this time due to the lack of a packed argument, we can use default arguments!
         /**
-         * @brief Function version of the class TestTwoVector
-         * @tparam T1 Type of the inputs
-         * @tparam U2 Type of the expected
-         * @tparam Callable Any function, method or lambda tha can be called upon
-         * @param inputs Inputs for each test
+         * @brief Tests that a parallel Callable gives the same output at every thread count and under perturbed schedules
+         * @tparam Callable Any function, method or lambda that can be called upon, as method(input, threads)
+         * @tparam Input The type of the input
          * @param method A Callable
-         * @param expected *optional* Expected output for each input test
-         * @param message *optional* A message appended to all results
-         * @param messages *optional* A message appended to nth result
-         * @return A vector of Results
+         * @param input The input, the same for every run
+         * @param threadCounts The thread counts to run at, the first output is the reference
+         * @param rounds How many runs per thread count; the first is undisturbed, the others perturb the schedule
+         * @param divergenceDir Where the first divergent pair of outputs is written, for a diff tool
+         * @return A failing Result for every run whose output differs from the reference, followed by a summary Result
+         *
+         * Outputs are compared by their hashValue, so floating point results have to match bit for bit. A perturbed
+         * round sets scheduleSeed, which makes every schedulePoint (parallelFor calls it before every chunk) delay its
+         * thread at random, and every other one also runs busy threads next to the Callable to force preemptions.
+         * The first divergent pair is written with toExactDisplay as "reference.txt" and "divergent.txt".
          */
-        template<typename T1, typename U2, typename Callable>
-        std::vector<Result> testTwoVectorMethod(std::vector<T1> inputs, Callable &method, std::vector<U2> expected = {}, std::string message = "", std::vector<std::string> messages = {}) {
-            std::vector<Result> testResults = TestTwoVector<T1, U2>(inputs, expected, message, messages, static_cast<int>(results.size() + 1)).RunAll(method);
-            results.reserve(testResults.size());
+        template<typename Callable, typename Input>
+        std::vector<Result> testDeterministic(Callable &method, const Input &input, const std::vector<unsigned int> &threadCounts, int rounds = 4,
+                                              const std::filesystem::path &divergenceDir = "determinism") {
+            using Output = std::decay_t<std::invoke_result_t<Callable &, const Input &, unsigned int>>;
+            int group = static_cast<int>(results.size() + 1);
+            std::vector<Result> testResults;
+            std::optional<Output> reference;
+            std::uint64_t referenceHash = 0;
+            std::string referenceRun;
+            bool saved = false;
+            int runs = 0;
+            auto threadsName = [](unsigned int count) { return std::to_string(count) + (count == 1 ? " thread" : " threads"); };
+            for(unsigned int threadCount : threadCounts) {
+                for(int round = 0; round < std::max(1, rounds); round++) {
+                    runs++;
+                    std::string run = threadsName(threadCount) + (round == 0 ? "" : ", perturbed round " + std::to_string(round));
+                    std::atomic<bool> busy = round != 0 && round % 2 == 0;
+                    std::vector<std::thread> noise;
+                    if(busy) {
+                        for(unsigned int t = 0; t < std::max(1u, std::thread::hardware_concurrency()); t++) {
+                            noise.emplace_back([&busy] {
+                                while(busy.load(std::memory_order_relaxed)) {
+                                    std::this_thread::yield();
+                                }
+                            });
+                        }
+                    }
+                    scheduleSeed = round == 0 ? 0 : (static_cast<std::uint64_t>(threadCount) << 32 | static_cast<std::uint64_t>(round)) * 0x9E3779B97F4A7C15ULL | 1;
+                    std::optional<Output> output;
+                    std::string error;
+                    try {
+                        output.emplace(std::invoke(method, input, threadCount));
+                    }
+                    catch(std::exception &e) {
+                        error = e.what();
+                    }
+                    scheduleSeed = 0;
+                    busy = false;
+                    for(std::thread &thread : noise) {
+                        thread.join();
+                    }
+                    if(!output) {
+                        testResults.emplace_back(" Failed: " + run + ", Exception Thrown: " + error, false, group, runs);
+                        continue;
+                    }
+                    std::uint64_t hash = 0xCBF29CE484222325ULL;
+                    hashValue(*output, hash);
+                    if(!reference) {
+                        reference = std::move(output);
+                        referenceHash = hash;
+                        referenceRun = run;
+                        continue;
+                    }
+                    if(hash == referenceHash) {
+                        continue;
+                    }
+                    std::ostringstream text;
+                    text << " Failed: " << run << " gave output hash " << std::hex << hash << ", " << referenceRun << " gave " << referenceHash;
+                    if(!saved) {
+                        std::error_code ignored;
+                        std::filesystem::create_directories(divergenceDir, ignored);
+                        saved = writeFile(divergenceDir / "reference.txt", toExactDisplay(*reference)) && writeFile(divergenceDir / "divergent.txt", toExactDisplay(*output));
+                        if(saved) {
+                            text << ", saved to " << (divergenceDir / "reference.txt").string() << " and " << (divergenceDir / "divergent.txt").string();
+                        }
+                    }
+                    testResults.emplace_back(text.str(), false, group, runs);
+                }
+            }
+            bool passed = testResults.empty() && reference.has_value();
+            std::ostringstream summary;
+            summary << (passed ? " Passed: " : " Failed: ") << runs - static_cast<int>(testResults.size()) << "/" << runs << " runs over " << threadCounts.size()
+                    << " thread counts gave the same output";
+            testResults.emplace_back(summary.str(), passed, group, runs + 1);
             results.emplace_back(testResults);
             return testResults;
         }
 
-
-
         /**
          * @brief Checks if a Callable throws the same exception as specified
          * @tparam Callable Any function, method or lambda that can be called upon
@@ -807,7 +5257,389 @@ namespace TesterLib {
             }
         }
 
-
+
+
+        /**
+         * @brief Checks which exception a Callable throws for every input of a list, by type and message
+         * @tparam Exceptions The catch list, the exception types that are told apart, checked in order
+         * @tparam T1 The type of the inputs
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param inputs The inputs, called as method(input, args...)
+         * @param expected What every input should throw, if smaller the last value is used for the rest,
+         *        empty for any exception of the catch list
+         * @param method A Callable
+         * @param args An Args for method's arguments
+         * @return Only the inputs that did not throw as expected, followed by one summary Result
+         *
+         * An ExpectedThrow names the expected exception by its index in the catch list (or NoThrow, AnyListed, Unlisted
+         * or NonStandard) and optionally its exact what(); any other type throws std::invalid_argument. Exceptions that are not in the catch list, including ones that do not derive
+         * from std::exception, are caught and reported as mismatches. Nothing is allocated for inputs that match. The
+         * inputs run in parallel batches (see setThreads), so method has to be safe to call from several threads.
+         */
+        template<typename... Exceptions, typename T1, typename Callable, typename... Args>
+        std::vector<Result> testExceptions(const std::vector<T1> &inputs, const std::vector<ExpectedThrow> &expected, Callable &method, Args... args) {
+            return exceptionBatch<Exceptions...>(inputs.size(), expected, [&inputs](std::size_t i) { return "input " + std::to_string(i + 1) + " (" + toDisplay(inputs[i]) + ")"; },
+                                                 [&](std::size_t i) { std::invoke(method, inputs[i], args...); });
+        }
+
+        /**
+         * @brief Checks which exception a Callable throws for every integer of a range, see the vector version
+         * @param from Starting range (inclusive)
+         * @param to Ending range (inclusive)
+         */
+        template<typename... Exceptions, typename Callable, typename... Args>
+        std::vector<Result> testExceptions(int from, int to, const std::vector<ExpectedThrow> &expected, Callable &method, Args... args) {
+            auto count = static_cast<std::size_t>(std::max(0LL, static_cast<long long>(to) - from + 1));
+            return exceptionBatch<Exceptions...>(count, expected, [from](std::size_t i) { return std::to_string(from + static_cast<long long>(i)); },
+                                                 [&](std::size_t i) { std::invoke(method, static_cast<int>(from + static_cast<long long>(i)), args...); });
+        }
+
+        /**
+         * @brief Compares two containers as multisets, for outputs in unspecified order
+         * @tparam Container1 Any forward range
+         * @tparam Container2 Any forward range with the same value type
+         * @tparam Hash The hash of the values, std::hash by default
+         * @param actual The output that is tested
+         * @param expected The expected elements, in any order
+         * @param hash Hashes a value
+         * @return One failing Result per distinct element with a different count, followed by a summary Result
+         *
+         * The elements are neither copied nor sorted: the comparison works on pointers into both containers, hashing
+         * every element once and counting them in open addressing tables. Large inputs are split into shards by hash,
+         * and the shards are counted in parallel (see setThreads), so it takes O(n) expected time and memory. Elements
+         * are compared with operator==. As it keeps pointers, both containers have to hold their elements: proxy and
+         * generating ranges such as std::vector<bool> or std::views::iota do not compile.
+         */
+        template<typename Container1, typename Container2, typename Hash = std::hash<std::ranges::range_value_t<Container1>>>
+        std::vector<Result> testUnordered(const Container1 &actual, const Container2 &expected, Hash hash = Hash()) {
+            using Value = std::ranges::range_value_t<Container1>;
+            static_assert(std::is_same_v<Value, std::ranges::range_value_t<Container2>>, "testUnordered needs two containers of the same type of elements");
+            static_assert(std::is_lvalue_reference_v<std::ranges::range_reference_t<const Container1>> && std::is_lvalue_reference_v<std::ranges::range_reference_t<const Container2>>,
+                          "testUnordered keeps pointers to the elements, so it needs containers that hold them (not std::vector<bool> or generating views, copy those into a std::vector first)");
+            int group = static_cast<int>(results.size() + 1);
+            struct Element {
+                const Value *value;
+                std::size_t hash;
+                std::size_t order; // actual first, then expected, to report in a stable order
+                bool operator==(const Element &other) const {
+                    return hash == other.hash && *value == *other.value;
+                }
+            };
+            std::vector<Element> elements;
+            elements.reserve(static_cast<std::size_t>(std::ranges::distance(actual) + std::ranges::distance(expected)));
+            for(const Value &value : actual) {
+                elements.push_back({&value, 0, elements.size()});
+            }
+            std::size_t actualCount = elements.size();
+            for(const Value &value : expected) {
+                elements.push_back({&value, 0, elements.size()});
+            }
+            unsigned int workers = threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threads;
+            // enough shards to keep every thread busy, and small enough for the table of a shard to stay in cache
+            std::size_t shards = elements.size() < (1 << 16) ? 1 : std::max<std::size_t>(static_cast<std::size_t>(workers) * 4, elements.size() >> 16);
+            // hash every element, then counting sort the indices by shard into one array: every part of the elements
+            // counts its shards, the counts give every (shard, part) its offset, and every part scatters its indices
+            std::size_t parts = std::min<std::size_t>(workers, std::max<std::size_t>(1, elements.size() >> 14));
+            std::size_t partSize = (elements.size() + parts - 1) / std::max<std::size_t>(parts, 1);
+            std::vector<std::size_t> offsets(parts * shards + 1); // [shard * parts + part]
+            parallelFor(parts, threads, 1, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t part = begin; part < end; part++) {
+                    for(std::size_t i = part * partSize; i < std::min(elements.size(), (part + 1) * partSize); i++) {
+                        elements[i].hash = hash(*elements[i].value);
+                        offsets[elements[i].hash % shards * parts + part + 1]++;
+                    }
+                }
+            });
+            std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+            std::vector<std::size_t> byShard(elements.size());
+            parallelFor(parts, threads, 1, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t part = begin; part < end; part++) {
+                    std::vector<std::size_t> next(shards);
+                    for(std::size_t shard = 0; shard < shards; shard++) {
+                        next[shard] = offsets[shard * parts + part];
+                    }
+                    for(std::size_t i = part * partSize; i < std::min(elements.size(), (part + 1) * partSize); i++) {
+                        byShard[next[elements[i].hash % shards]++] = i;
+                    }
+                }
+            });
+            // count every shard: +1 for every element of actual, -1 for every element of expected
+            std::vector<std::vector<std::pair<Element, long long>>> differences(shards);
+            parallelFor(shards, threads, 1, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t shard = begin; shard < end; shard++) {
+                    std::size_t first = offsets[shard * parts];
+                    std::size_t last = offsets[(shard + 1) * parts];
+                    std::size_t size = last - first;
+                    // an open addressing table of element index -> count, at most half full
+                    int bits = std::max(1, static_cast<int>(std::bit_width(size * 2)));
+                    std::size_t mask = (std::size_t{1} << bits) - 1;
+                    constexpr std::size_t empty = std::numeric_limits<std::size_t>::max();
+                    std::vector<std::size_t> slots(mask + 1, empty);
+                    std::vector<long long> counts(mask + 1);
+                    for(std::size_t k = first; k < last; k++) {
+                        std::size_t index = byShard[k];
+                        const Element &element = elements[index];
+                        auto slot = static_cast<std::size_t>((static_cast<std::uint64_t>(element.hash) * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+                        while(slots[slot] != empty && !(elements[slots[slot]] == element)) {
+                            slot = (slot + 1) & mask;
+                        }
+                        if(slots[slot] == empty) {
+                            slots[slot] = index;
+                        }
+                        counts[slot] += element.order < actualCount ? 1 : -1;
+                    }
+                    for(std::size_t slot = 0; slot <= mask; slot++) {
+                        if(counts[slot] != 0) {
+                            differences[shard].emplace_back(elements[slots[slot]], counts[slot]);
+                        }
+                    }
+                }
+            });
+            std::vector<std::pair<Element, long long>> found;
+            for(auto &shard : differences) {
+                std::move(shard.begin(), shard.end(), std::back_inserter(found));
+            }
+            std::sort(found.begin(), found.end(), [](const auto &a, const auto &b) { return a.first.order < b.first.order; });
+            std::vector<Result> testResults;
+            long long missing = 0;
+            long long extra = 0;
+            for(const auto &[element, count] : found) {
+                (count > 0 ? extra : missing) += std::abs(count);
+                testResults.emplace_back(std::string(count > 0 ? " Extra: " : " Missing: ") + std::to_string(std::abs(count)) + " x " + toDisplay(*element.value),
+                                         false, group, static_cast<int>(testResults.size() + 1));
+            }
+            bool state = found.empty();
+            testResults.emplace_back(std::string(state ? " Passed" : " Failed") + ": " + std::to_string(actualCount) + " actual and "
+                                     + std::to_string(elements.size() - actualCount) + " expected elements, " + std::to_string(missing) + " missing, "
+                                     + std::to_string(extra) + " extra", state, group, static_cast<int>(testResults.size() + 1));
+            results.emplace_back(testResults);
+            return testResults;
+        }
+
+        /**
+         * @brief Checks that a contiguous range is sorted
+         * @tparam Range Any contiguous range, e.g. std::vector or std::span
+         * @tparam Compare A strict weak ordering, std::less by default
+         * @param range The elements
+         * @param compare The ordering
+         * @return A Result with the number of violations and the index of the first, an index i where compare(range[i], range[i - 1])
+         *
+         * Like every check* method, it runs in parallel (see setThreads) with a kernel the compiler can vectorize, and
+         * adds one Result as its own group.
+         */
+        template<std::ranges::contiguous_range Range, typename Compare = std::less<>>
+        Result checkSorted(const Range &range, Compare compare = Compare()) {
+            auto data = std::ranges::data(range);
+            std::size_t size = std::ranges::size(range);
+            return checkInvariant("sorted", 1, size, size, [data, &compare](std::size_t i) { return static_cast<bool>(compare(data[i], data[i - 1])); });
+        }
+
+        /**
+         * @brief Checks that every element of a contiguous range is larger than the one before, a violation is an index i where !(range[i - 1] < range[i])
+         */
+        template<std::ranges::contiguous_range Range>
+        Result checkStrictlyIncreasing(const Range &range) {
+            auto data = std::ranges::data(range);
+            std::size_t size = std::ranges::size(range);
+            return checkInvariant("strictly increasing", 1, size, size, [data](std::size_t i) { return !(data[i - 1] < data[i]); });
+        }
+
+        /**
+         * @brief Checks that every element of a contiguous range is within [low, high], NaN is a violation as well
+         */
+        template<std::ranges::contiguous_range Range, typename T>
+        Result checkBounds(const Range &range, const T &low, const T &high) {
+            auto data = std::ranges::data(range);
+            std::size_t size = std::ranges::size(range);
+            return checkInvariant("within [" + toDisplay(low) + ", " + toDisplay(high) + "]", 0, size, size,
+                                  [data, &low, &high](std::size_t i) { return !(low <= data[i] && data[i] <= high); });
+        }
+
+        /**
+         * @brief Checks that no element of a contiguous range of floating point numbers is NaN
+         */
+        template<std::ranges::contiguous_range Range>
+        Result checkNoNaN(const Range &range) {
+            static_assert(std::is_floating_point_v<std::ranges::range_value_t<Range>>, "checkNoNaN needs floating point elements");
+            auto data = std::ranges::data(range);
+            std::size_t size = std::ranges::size(range);
+            return checkInvariant("no NaN", 0, size, size, [data](std::size_t i) { return data[i] != data[i]; });
+        }
+
+        /**
+         * @brief Checks that prefix holds the inclusive prefix sums of input
+         * @param input The elements
+         * @param prefix The prefix sums, prefix[i] = input[0] + ... + input[i]
+         * @param tolerance How far prefix[i] - prefix[i - 1] may be from input[i], for floating point sums
+         * @return A Result with the number of violations and the index of the first
+         *
+         * Every index is checked against the one before, |prefix[i] - prefix[i - 1] - input[i]| <= tolerance, so the
+         * check runs in parallel. A wrong prefix sum is a violation at its index and, unless the next one is wrong in
+         * the same way, at the next index. A different size is a violation at the end of the shorter one.
+         */
+        template<std::ranges::contiguous_range Range1, std::ranges::contiguous_range Range2>
+        Result checkPrefixSums(const Range1 &input, const Range2 &prefix, double tolerance = 0) {
+            using Sum = std::ranges::range_value_t<Range2>;
+            auto values = std::ranges::data(input);
+            auto sums = std::ranges::data(prefix);
+            std::size_t size = std::min(std::ranges::size(input), std::ranges::size(prefix));
+            if(std::ranges::size(input) != std::ranges::size(prefix)) {
+                Result result(" Failed: prefix sums, " + std::to_string(std::ranges::size(prefix)) + " prefix sums for " + std::to_string(std::ranges::size(input))
+                              + " elements, first at index " + std::to_string(size), false, static_cast<int>(results.size() + 1), 1);
+                results.emplace_back(std::vector<Result>{result});
+                return result;
+            }
+            return checkInvariant("prefix sums", 0, size, size, [values, sums, tolerance](std::size_t i) {
+                Sum difference = sums[i] - (i == 0 ? Sum() : sums[i - 1]) - static_cast<Sum>(values[i]);
+                if constexpr(std::is_floating_point_v<Sum>) {
+                    return !(std::abs(difference) <= tolerance);
+                }
+                else {
+                    return static_cast<double>(difference < Sum() ? -difference : difference) > tolerance;
+                }
+            });
+        }
+
+        /**
+         * @brief Checks that no two elements of a contiguous range are equal, in any order
+         * @tparam Hash The hash of the elements, std::hash by default
+         * @return A Result with the number of elements equal to an earlier one, and the index of the first such element
+         *
+         * The elements are hashed in parallel and then looked up in order in an open addressing table of indexes.
+         * For a sorted range checkStrictlyIncreasing does the same without hashing.
+         */
+        template<std::ranges::contiguous_range Range, typename Hash = std::hash<std::ranges::range_value_t<Range>>>
+        Result checkUnique(const Range &range, Hash hash = Hash()) {
+            auto data = std::ranges::data(range);
+            std::size_t size = std::ranges::size(range);
+            std::vector<std::size_t> hashes(size);
+            parallelFor(size, threads, 1 << 16, [&](std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; i++) {
+                    hashes[i] = hash(data[i]);
+                }
+            });
+            int bits = std::max(1, static_cast<int>(std::bit_width(size * 2)));
+            std::size_t mask = (std::size_t{1} << bits) - 1;
+            constexpr std::size_t empty = std::numeric_limits<std::size_t>::max();
+            std::vector<std::size_t> slots(mask + 1, empty);
+            std::vector<bool> duplicate(size);
+            for(std::size_t i = 0; i < size; i++) {
+                auto slot = static_cast<std::size_t>((static_cast<std::uint64_t>(hashes[i]) * 0x9E3779B97F4A7C15ULL) >> (64 - bits));
+                while(slots[slot] != empty && !(hashes[slots[slot]] == hashes[i] && data[slots[slot]] == data[i])) {
+                    slot = (slot + 1) & mask;
+                }
+                if(slots[slot] == empty) {
+                    slots[slot] = i;
+                }
+                else {
+                    duplicate[i] = true;
+                }
+            }
+            return checkInvariant("unique", 0, size, size, [&duplicate](std::size_t i) { return static_cast<bool>(duplicate[i]); });
+        }
+
+        /**
+         * @brief Sets how every following testRange looks for performance cliffs
+         * @param options The CliffOptions, with enabled = true to time the range after checking it
+         */
+        void setCliffOptions(const CliffOptions &options) {
+            cliffOptions = options;
+        }
+
+        /**
+         * @brief Sets the options used by every following timing test
+         * @param options The TimingOptions, e.g. with backend = TimerBackend::Tsc for nanosecond scale callables
+         */
+        void setTimingOptions(const TimingOptions &options) {
+            timingOptions = options;
+        }
+
+        /**
+         * @brief Times a Callable, optionally evicting the caches before every iteration
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param iterations How many times to time the Callable
+         * @param mode CacheMode::Hot, CacheMode::Sweep or CacheMode::Flush
+         * @param method A Callable
+         * @param args An Args for method's arguments
+         * @return A Result with the timing summary, the full summary is kept in getTimings()
+         */
+        template<typename Callable, typename... Args>
+        Result testTiming(int iterations, CacheMode mode, Callable &method, Args... args) {
+            TestTiming timing(iterations, mode, "", static_cast<int>(results.size() + 1), timingOptions);
+            Result res = timing.Run(method, args...);
+            timings.push_back(timing.GetStats());
+            results.emplace_back(std::vector<Result>{res});
+            return res;
+        }
+
+        /**
+         * @brief Times a Callable while rotating through a pool of inputs, like testTwoVectorMethod's inputs
+         * @tparam T1 Type of the inputs
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param inputs The pool of inputs, each is put in as the first argument of method
+         * @param iterations How many times to time the Callable
+         * @param mode CacheMode::Hot, CacheMode::Sweep or CacheMode::Flush
+         * @param method A Callable
+         * @param args An Args for method's arguments
+         * @return A Result with the timing summary, the full summary is kept in getTimings()
+         */
+        template<typename T1, typename Callable, typename... Args>
+        Result testTimingInputs(std::vector<T1> inputs, int iterations, CacheMode mode, Callable &method, Args... args) {
+            TestTiming timing(iterations, mode, "", static_cast<int>(results.size() + 1), timingOptions);
+            Result res = timing.RunInputs(inputs, method, args...);
+            timings.push_back(timing.GetStats());
+            results.emplace_back(std::vector<Result>{res});
+            return res;
+        }
+
+        /**
+         * @brief Runs a Callable on several pinned worker threads at once and measures the throughput
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param threads The number of worker threads
+         * @param iterations How many calls each worker makes
+         * @param method A Callable, called concurrently from every worker
+         * @param args An Args for method's arguments, shared by all workers
+         * @return A Result with the time per call and calls per second, the full summary is kept in getTimings()
+         */
+        template<typename Callable, typename... Args>
+        Result testThroughput(int threads, int iterations, Callable &method, Args... args) {
+            TestTiming timing(iterations, CacheMode::Hot, "", static_cast<int>(results.size() + 1), timingOptions);
+            Result res = timing.RunThroughput(threads, method, args...);
+            timings.push_back(timing.GetStats());
+            results.emplace_back(std::vector<Result>{res});
+            return res;
+        }
+
+        /**
+         * @brief Runs a Callable under every std::pmr memory resource and compares them
+         * @tparam T1 The return type of the Callable
+         * @tparam Callable Any function, method or lambda that can be called upon
+         * @tparam Args The arguments for Callable
+         * @param expected Expected output for each resource, if smaller the last value is used for the rest
+         * @param iterations How many timed calls per resource
+         * @param method A Callable whose first parameter is a std::pmr::memory_resource*
+         * @param args An Args for method's arguments
+         * @return A vector of Results, one per resource, with pass/fail, median time and allocation counts
+         *
+         * The resources are new_delete, monotonic_buffer, unsynchronized_pool and synchronized_pool, in that order.
+         * The timing of every resource is kept in getTimings().
+         */
+        template<typename T1, typename Callable, typename... Args>
+        std::vector<Result> testMemoryResources(std::vector<T1> expected, int iterations, Callable &method, Args... args) {
+            TestMemoryResource<T1> test(iterations, expected, "", {}, static_cast<int>(results.size() + 1), timingOptions);
+            std::vector<Result> testResults = test.RunAll(method, args...);
+            timings.insert(timings.end(), test.GetStats().begin(), test.GetStats().end());
+            results.emplace_back(testResults);
+            return testResults;
+        }
+        template<typename Callable, typename... Args>
+        std::vector<Result> testMemoryResources(int iterations, Callable &method, Args... args) {
+            return testMemoryResources(std::vector<int>{}, iterations, method, args...);
+        }
 
         /**
          * @brief Prints the results of the vector results
@@ -891,14 +5723,783 @@ namespace TesterLib {
             }
         }
 
+        /**
+         * @brief Tags every following group, for the filters of writeReport
+         * @param tag The tag, empty for none
+         */
+        void setTag(const std::string &tag) {
+            int next = static_cast<int>(results.size() + 1);
+            if(!tags.empty() && tags.back().first == next) {
+                tags.back().second = tag;
+            }
+            else {
+                tags.emplace_back(next, tag);
+            }
+        }
+
+        /**
+         * @brief The tag that the next group gets
+         */
+        std::string getTag() const {
+            return tags.empty() ? "" : tags.back().second;
+        }
+
+        /**
+         * @brief The tag of a group
+         * @param group The group number
+         * @return The tag set with setTag before the group was added, empty if there was none
+         */
+        std::string tagOf(int group) const {
+            auto after = std::upper_bound(tags.begin(), tags.end(), group, [](int g, const std::pair<int, std::string> &tag) { return g < tag.first; });
+            return after == tags.begin() ? "" : std::prev(after)->second;
+        }
+
+        /**
+         * @brief Writes an HTML report that can be browsed for millions of results
+         * @param directory Where to write the report, created if it does not exist
+         * @param chunkSize How many results go in each data file
+         * @return false if a file could not be written
+         *
+         * The results are written in order to data/chunk-N.js files of chunkSize results each, so only one chunk is
+         * held in memory at a time. The totals of every group go the same way to data/groups-N.js files of 1000 groups.
+         * data/index.js holds what is in every chunk, the runs of tags set by setTag and the first 100 failures, so
+         * its size does not grow with the number of results or groups. index.html loads the chunks it needs as it is
+         * scrolled and the group totals a page at a time, and can filter by state, group and tag and sort by duration.
+         * The data files are JavaScript rather than JSON so the report can be opened from disk.
+         */
+        bool writeReport(const std::string &directory, std::size_t chunkSize = 50000) const {
+            std::error_code error;
+            std::filesystem::path root(directory);
+            std::filesystem::create_directories(root / "data", error);
+            if(error) {
+                return false;
+            }
+            chunkSize = std::max<std::size_t>(1, chunkSize);
+            constexpr std::size_t groupsPerFile = 1000;
+            std::string chunk;
+            std::string chunkIndex;
+            std::string groupChunk; // the totals of groupsPerFile groups, written to data/groups-N.js like the rows
+            std::string failures;
+            std::size_t rows = 0;
+            std::size_t passed = 0;
+            std::size_t inChunk = 0;
+            std::size_t chunkFailed = 0;
+            std::size_t chunks = 0;
+            std::size_t failuresListed = 0;
+            int firstGroup = 0;
+            int lastGroup = 0;
+            auto flush = [&]() {
+                chunk += "]);\n";
+                chunkIndex += std::string(chunks == 0 ? "" : ",") + "{\"count\":" + std::to_string(inChunk) + ",\"failed\":" + std::to_string(chunkFailed)
+                              + ",\"firstGroup\":" + std::to_string(firstGroup) + ",\"lastGroup\":" + std::to_string(lastGroup) + "}";
+                bool written = writeFile(root / "data" / ("chunk-" + std::to_string(chunks) + ".js"), chunk);
+                chunks++;
+                inChunk = 0;
+                chunkFailed = 0;
+                chunk.clear();
+                return written;
+            };
+            for(std::size_t g = 0; g < results.size(); g++) {
+                std::size_t groupFailed = 0;
+                long long groupDuration = 0;
+                for(const Result &result : results[g]) {
+                    if(inChunk == 0) {
+                        chunk = "TesterReport.setChunk(" + std::to_string(chunks) + ",[";
+                        firstGroup = result.groupNum;
+                    }
+                    else {
+                        chunk += ',';
+                    }
+                    appendReportRow(chunk, result);
+                    lastGroup = result.groupNum;
+                    groupDuration += result.durationNs;
+                    if(result.state) {
+                        passed++;
+                    }
+                    else {
+                        groupFailed++;
+                        chunkFailed++;
+                        if(failuresListed++ < 100) {
+                            if(!failures.empty()) {
+                                failures += ',';
+                            }
+                            appendReportRow(failures, result);
+                        }
+                    }
+                    rows++;
+                    if(++inChunk == chunkSize && !flush()) {
+                        return false;
+                    }
+                }
+                groupChunk += std::string(g % groupsPerFile == 0 ? "TesterReport.setGroups(" + std::to_string(g / groupsPerFile) + ",[" : ",")
+                              + "[" + std::to_string(results[g].size()) + "," + std::to_string(groupFailed) + "," + std::to_string(groupDuration) + "]";
+                if((g + 1) % groupsPerFile == 0 || g + 1 == results.size()) {
+                    groupChunk += "]);\n";
+                    if(!writeFile(root / "data" / ("groups-" + std::to_string(g / groupsPerFile) + ".js"), groupChunk)) {
+                        return false;
+                    }
+                    groupChunk.clear();
+                }
+            }
+            if(inChunk > 0 && !flush()) {
+                return false;
+            }
+            // tags as the runs setTag made, [first group, tag], so the index does not grow with the number of groups
+            std::string tagRuns;
+            for(const auto &[first, tag] : tags) {
+                if(first <= static_cast<int>(results.size())) {
+                    tagRuns += std::string(tagRuns.empty() ? "[" : ",[") + std::to_string(first) + ",";
+                    appendJsonString(tagRuns, tag);
+                    tagRuns += "]";
+                }
+            }
+            std::string index = "TesterReport.setIndex({\"rows\":" + std::to_string(rows) + ",\"passed\":" + std::to_string(passed)
+                                + ",\"chunkSize\":" + std::to_string(chunkSize) + ",\"chunks\":[" + chunkIndex + "],\"groups\":" + std::to_string(results.size())
+                                + ",\"groupsPerFile\":" + std::to_string(groupsPerFile) + ",\"tags\":[" + tagRuns + "],\"failures\":[" + failures + "]});\n";
+            return writeFile(root / "data" / "index.js", index) && writeFile(root / "index.html", reportPage);
+        }
+
+        /**
+         * @brief Moves the results and timings of another Tester to the end of this one
+         * @param other The Tester to take from, it is empty afterwards
+         *
+         * The groups of other are renumbered to follow the groups of this Tester. The groups are moved,
+         * so no Result is copied, which makes it cheap to merge one Tester per worker thread at the end.
+         */
+        void merge(Tester &&other) {
+            if(&other == this) {
+                return;
+            }
+            int offset = static_cast<int>(results.size());
+            // the merged groups keep their own tags (none before other's first setTag), and the current tag is
+            // restored after them, so tags set on this Tester never leak onto other's groups or the other way round
+            std::string current = getTag();
+            tags.emplace_back(offset + 1, "");
+            for(const auto &[first, tag] : other.tags) {
+                tags.emplace_back(first + offset, tag);
+            }
+            tags.emplace_back(offset + static_cast<int>(other.results.size()) + 1, current);
+            other.tags.clear();
+            results.reserve(results.size() + other.results.size());
+            for(std::vector<Result> &group : other.results) {
+                for(Result &result : group) {
+                    result.groupNum = static_cast<int>(results.size() + 1);
+                }
+                results.push_back(std::move(group));
+            }
+            for(TimingStats &timing : other.timings) {
+                timing.groupNum += offset;
+                timings.push_back(std::move(timing));
+            }
+            other.results.clear();
+            other.timings.clear();
+        }
+
+        /**
+         * @brief Writes the results to a binary file, to be merged by another Tester (or process) with mergeFile
+         * @param path The file to write
+         * @return false if the file could not be written
+         */
+        bool saveResults(const std::string &path) const {
+            std::ofstream file(path, std::ios::binary | std::ios::trunc);
+            if(!file) {
+                return false;
+            }
+            auto groups = static_cast<std::uint32_t>(results.size());
+            file.write("TLRS", 4);
+            file.write(reinterpret_cast<const char *>(&resultFileVersion), sizeof(resultFileVersion));
+            file.write(reinterpret_cast<const char *>(&groups), sizeof(groups));
+            std::string buffer;
+            for(const std::vector<Result> &group : results) {
+                buffer.clear();
+                for(const Result &result : group) {
+                    result.serialize(buffer);
+                }
+                auto count = static_cast<std::uint32_t>(group.size());
+                auto bytes = static_cast<std::uint64_t>(buffer.size());
+                file.write(reinterpret_cast<const char *>(&count), sizeof(count));
+                file.write(reinterpret_cast<const char *>(&bytes), sizeof(bytes));
+                file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            }
+            return static_cast<bool>(file.flush());
+        }
+
+        /**
+         * @brief Adds the results of a file written by saveResults to the end of this Tester
+         * @param path The file to read
+         * @return false if the file could not be read or is not a result file, nothing is added in that case
+         *
+         * The groups are renumbered to follow the groups of this Tester. The file is read one group at a time.
+         */
+        bool mergeFile(const std::string &path) {
+            std::ifstream file(path, std::ios::binary | std::ios::ate);
+            auto size = static_cast<std::uint64_t>(std::max<std::streamoff>(0, file.tellg()));
+            file.seekg(0);
+            char magic[4] = {};
+            std::uint32_t version = 0;
+            std::uint32_t groups = 0;
+            file.read(magic, 4);
+            file.read(reinterpret_cast<char *>(&version), sizeof(version));
+            file.read(reinterpret_cast<char *>(&groups), sizeof(groups));
+            if(!file || std::string(magic, 4) != "TLRS" || version != resultFileVersion) {
+                return false;
+            }
+            std::vector<std::vector<Result>> read;
+            std::string buffer;
+            for(std::uint32_t g = 0; g < groups; g++) {
+                std::uint32_t count = 0;
+                std::uint64_t bytes = 0;
+                file.read(reinterpret_cast<char *>(&count), sizeof(count));
+                file.read(reinterpret_cast<char *>(&bytes), sizeof(bytes));
+                // the sizes come from the file, so check them before allocating
+                if(!file || bytes > size - static_cast<std::uint64_t>(file.tellg()) || count > bytes / Result::serializedHeader) {
+                    return false;
+                }
+                buffer.resize(bytes);
+                file.read(buffer.data(), static_cast<std::streamsize>(bytes));
+                if(!file) {
+                    return false;
+                }
+                const char *cursor = buffer.data();
+                std::vector<Result> group(count, Result{"", false});
+                for(Result &result : group) {
+                    if(!Result::deserialize(cursor, buffer.data() + buffer.size(), result)) {
+                        return false;
+                    }
+                    result.groupNum = static_cast<int>(results.size() + read.size() + 1);
+                }
+                read.push_back(std::move(group));
+            }
+            results.reserve(results.size() + read.size());
+            std::move(read.begin(), read.end(), std::back_inserter(results));
+            return true;
+        }
+
         /**
          * @brief Get results
+         * @return The stored results, not a copy. Use query() to filter them without copying.
          */
-        std::vector<std::vector<Result>> getResults() {
+        const std::vector<std::vector<Result>> &getResults() const {
             return results;
         }
+
+        /**
+         * @brief A view of every result, to be filtered, counted and iterated without copying
+         * @return A ResultView, which with its iterators is invalidated by anything that adds results
+         */
+        ResultView query() const {
+            return ResultView(results);
+        }
+
+        /**
+         * @brief Get the timing summaries of every timing test (testTiming, testTimingInputs, testThroughput, testMemoryResources)
+         */
+        const std::vector<TimingStats> &getTimings() const {
+            return timings;
+        }
+    };
+
+    /**
+     * @brief What a scheduled group needs while it runs
+     *  All fields are public for easy debugging
+     */
+    class GroupRequirements {
+    public:
+        std::vector<std::string> dependsOn = {}; // groups that have to finish first, e.g. the one that sets up a shared fixture
+        unsigned int threads = 1;                // threads the group keeps busy
+        std::vector<std::string> exclusive = {}; // resources (a port, a file, ...) that no other running group may hold
+        unsigned long long memory = 0;           // bytes the group needs
+        double cost = 1;                         // estimated run time in any unit, used to pack heavy and light groups
+    };
+
+    /**
+     * @brief Runs named groups of tests concurrently, in dependency order and within the available resources
+     *
+     * Every group is a function that runs its tests on a Tester of its own. Groups whose dependencies have finished
+     * are started as long as their threads, memory and exclusive resources are free. Among the groups that can start,
+     * the one with the longest chain of work behind it (its cost plus the costs of everything that depends on it)
+     * goes first, and lighter groups fill the threads that are left over. When everything is done the results are
+     * added to the target Tester in the order the groups were added, so group numbers do not depend on timing.
+     *
+     * A group that throws gets a failing Result, and every group that depends on it is skipped with a failing Result.
+     */
+    class TestScheduler {
+    private:
+        struct Group {
+            std::string name;
+            std::function<void(Tester &)> body;
+            GroupRequirements requirements;
+            std::vector<std::size_t> dependencies = {};
+            std::vector<std::size_t> dependents = {};
+            double priority = 0;
+        };
+        std::vector<Group> groups;
+
+        /**
+         * @brief Resolves the dependency names, rejects cycles and computes the priorities
+         */
+        void Prepare() {
+            std::map<std::string, std::size_t> byName;
+            for(std::size_t i = 0; i < groups.size(); i++) {
+                if(!byName.emplace(groups[i].name, i).second) {
+                    throw std::invalid_argument("TestScheduler: group '" + groups[i].name + "' was added twice");
+                }
+                groups[i].dependencies.clear();
+                groups[i].dependents.clear();
+            }
+            for(std::size_t i = 0; i < groups.size(); i++) {
+                for(const std::string &dependency : groups[i].requirements.dependsOn) {
+                    auto found = byName.find(dependency);
+                    if(found == byName.end()) {
+                        throw std::invalid_argument("TestScheduler: group '" + groups[i].name + "' depends on unknown group '" + dependency + "'");
+                    }
+                    groups[i].dependencies.push_back(found->second);
+                    groups[found->second].dependents.push_back(i);
+                }
+            }
+            // Kahn's algorithm, the reverse of the order gives every group after everything that depends on it
+            std::vector<std::size_t> remaining(groups.size());
+            std::vector<std::size_t> order;
+            for(std::size_t i = 0; i < groups.size(); i++) {
+                remaining[i] = groups[i].dependencies.size();
+                if(remaining[i] == 0) {
+                    order.push_back(i);
+                }
+            }
+            for(std::size_t next = 0; next < order.size(); next++) {
+                for(std::size_t dependent : groups[order[next]].dependents) {
+                    if(--remaining[dependent] == 0) {
+                        order.push_back(dependent);
+                    }
+                }
+            }
+            if(order.size() != groups.size()) {
+                throw std::invalid_argument("TestScheduler: the group dependencies have a cycle");
+            }
+            for(auto it = order.rbegin(); it != order.rend(); it++) {
+                Group &group = groups[*it];
+                double longest = 0;
+                for(std::size_t dependent : group.dependents) {
+                    longest = std::max(longest, groups[dependent].priority);
+                }
+                group.priority = std::max(0.0, group.requirements.cost) + longest;
+            }
+        }
+
+    public:
+        TestScheduler() = default;
+        ~TestScheduler() = default;
+
+        /**
+         * @brief Adds a group
+         * @param name A unique name, used by GroupRequirements::dependsOn
+         * @param body Runs the tests of the group on the Tester it is given
+         * @param requirements Dependencies and resource needs of the group
+         */
+        void Add(std::string name, std::function<void(Tester &)> body, GroupRequirements requirements = {}) {
+            groups.push_back(Group{std::move(name), std::move(body), std::move(requirements)});
+        }
+
+        /**
+         * @brief Runs every group and adds the results to tester in the order the groups were added
+         * @param tester The Tester that receives the results
+         * @param threads The number of threads to share between groups, 0 for std::thread::hardware_concurrency
+         * @param memory The memory to share between groups in bytes, 0 for no limit
+         *
+         * Every group is given its own Tester with the thread count, ProgressReporter, EventPublisher, timing and
+         * cliff options of tester, its thread count capped to GroupRequirements::threads. Throws
+         * std::invalid_argument for duplicate names, unknown dependencies and dependency cycles. A group that needs
+         * more threads or memory than there is runs once nothing else is running.
+         */
+        void Run(Tester &tester, unsigned int threads = 0, unsigned long long memory = 0) {
+            Prepare();
+            if(threads == 0) {
+                threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+            std::vector<Tester> testers(groups.size());
+            std::vector<std::size_t> remaining(groups.size());
+            std::vector<bool> failed(groups.size(), false);
+            std::vector<std::size_t> ready;
+            for(std::size_t i = 0; i < groups.size(); i++) {
+                remaining[i] = groups[i].dependencies.size();
+                if(remaining[i] == 0) {
+                    ready.push_back(i);
+                }
+            }
+            std::mutex mutex;
+            std::condition_variable finishedOne;
+            std::vector<std::size_t> finished;
+            std::vector<std::thread> running;
+            std::set<std::string> held;
+            unsigned int freeThreads = threads;
+            unsigned long long usedMemory = 0;
+            std::size_t active = 0;
+            std::size_t done = 0;
+
+            auto threadsOf = [&](const Group &group) { return std::clamp(group.requirements.threads, 1u, threads); };
+            // every group runs on its own Tester with the configuration of tester, capped to the threads it reserved
+            unsigned int configuredThreads = tester.threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : tester.threads;
+            for(std::size_t i = 0; i < groups.size(); i++) {
+                testers[i].timingOptions = tester.timingOptions;
+                testers[i].progress = tester.progress;
+                testers[i].events = tester.events;
+                testers[i].threads = std::min(configuredThreads, threadsOf(groups[i]));
+                testers[i].cliffOptions = tester.cliffOptions;
+            }
+            auto fits = [&](const Group &group) {
+                for(const std::string &resource : group.requirements.exclusive) {
+                    if(held.count(resource) != 0) {
+                        return false;
+                    }
+                }
+                if(active == 0) { // something has to run, even if it asks for more than there is
+                    return true;
+                }
+                return threadsOf(group) <= freeThreads && (memory == 0 || usedMemory + group.requirements.memory <= memory);
+            };
+
+            std::unique_lock<std::mutex> lock(mutex);
+            while(done < groups.size()) {
+                // the highest priority group that fits goes first, lighter ones fill what is left
+                std::sort(ready.begin(), ready.end(), [&](std::size_t a, std::size_t b) {
+                    return groups[a].priority != groups[b].priority ? groups[a].priority > groups[b].priority : a < b;
+                });
+                for(auto it = ready.begin(); it != ready.end();) {
+                    std::size_t index = *it;
+                    Group &group = groups[index];
+                    bool skip = std::any_of(group.dependencies.begin(), group.dependencies.end(), [&](std::size_t d) { return failed[d]; });
+                    if(skip) {
+                        testers[index].results.emplace_back(std::vector<Result>{Result{"Skipped group '" + group.name + "': a dependency failed", false, 1, 1}});
+                        failed[index] = true;
+                        finished.push_back(index);
+                        it = ready.erase(it);
+                        continue;
+                    }
+                    if(!fits(group)) {
+                        it++;
+                        continue;
+                    }
+                    freeThreads -= std::min(freeThreads, threadsOf(group));
+                    usedMemory += group.requirements.memory;
+                    held.insert(group.requirements.exclusive.begin(), group.requirements.exclusive.end());
+                    active++;
+                    it = ready.erase(it);
+                    running.emplace_back([&, index] {
+                        bool threw = false;
+                        std::string what;
+                        try {
+                            groups[index].body(testers[index]);
+                        }
+                        catch(std::exception &e) {
+                            threw = true;
+                            what = e.what();
+                        }
+                        catch(...) {
+                            threw = true;
+                            what = "unknown exception";
+                        }
+                        std::lock_guard<std::mutex> guard(mutex);
+                        if(threw) {
+                            Tester &groupTester = testers[index];
+                            groupTester.results.emplace_back(std::vector<Result>{Result{"Exception Thrown in group '" + groups[index].name + "': " + what, false, static_cast<int>(groupTester.results.size() + 1), 1}});
+                            failed[index] = true;
+                        }
+                        finished.push_back(index);
+                        finishedOne.notify_one();
+                    });
+                }
+                if(finished.empty()) {
+                    finishedOne.wait(lock, [&] { return !finished.empty(); });
+                }
+                for(std::size_t index : finished) {
+                    const Group &group = groups[index];
+                    bool ran = std::none_of(group.dependencies.begin(), group.dependencies.end(), [&](std::size_t d) { return failed[d]; });
+                    if(ran) {
+                        freeThreads += threadsOf(group);
+                        freeThreads = std::min(freeThreads, threads);
+                        usedMemory -= group.requirements.memory;
+                        for(const std::string &resource : group.requirements.exclusive) {
+                            held.erase(resource);
+                        }
+                        active--;
+                    }
+                    for(std::size_t dependent : group.dependents) {
+                        if(--remaining[dependent] == 0) {
+                            ready.push_back(dependent);
+                        }
+                    }
+                    done++;
+                }
+                finished.clear();
+            }
+            lock.unlock();
+            for(std::thread &worker : running) {
+                worker.join();
+            }
+            for(Tester &groupTester : testers) {
+                tester.merge(std::move(groupTester));
+            }
+        }
+    };
+
+    /**
+     * @brief A list of tests that are declared first and run later, all at once
+     *
+     * The methods mirror the ones of Tester, but instead of running the test they register it. run() then executes
+     * the whole plan: the tests are grouped by their concrete type (the kind of test together with the Callable and
+     * argument types), and each group is a batch whose inner loop calls the tests directly rather than through a
+     * virtual function. Every batch is spread across threads, and the Results are added to the Tester in the order
+     * the tests were declared, with the group numbers they would have gotten from calling the Tester directly.
+     *
+     * Arguments are copied into the plan, but Callables are kept by reference and have to outlive run(). Tests of
+     * the same plan run concurrently, so the Callables have to be safe to call from several threads.
+     */
+    class TestPlan {
+    private:
+        class BatchBase {
+        public:
+            virtual ~BatchBase() = default;
+            virtual std::size_t Size() const = 0;
+            virtual void Run(std::size_t begin, std::size_t end, int firstGroup, std::vector<std::vector<Result>> &slots) = 0;
+        };
+
+        /**
+         * @brief All the tests of one concrete type, with the position each was declared at
+         */
+        template<class Task>
+        class Batch : public BatchBase {
+        public:
+            std::vector<Task> tasks;
+            std::vector<std::size_t> positions;
+
+            std::size_t Size() const override {
+                return tasks.size();
+            }
+
+            void Run(std::size_t begin, std::size_t end, int firstGroup, std::vector<std::vector<Result>> &slots) override {
+                for(std::size_t i = begin; i < end; i++) {
+                    slots[positions[i]] = tasks[i](firstGroup + static_cast<int>(positions[i]));
+                }
+            }
+        };
+
+        std::vector<std::unique_ptr<BatchBase>> batches;
+        std::map<std::type_index, BatchBase *> batchOfType;
+        std::size_t declared = 0;
+
+        /**
+         * @brief Registers a task, task(int group) -> std::vector<Result>
+         */
+        template<typename Task>
+        void Register(Task task) {
+            BatchBase *&batch = batchOfType[std::type_index(typeid(Task))];
+            if(batch == nullptr) {
+                batches.push_back(std::make_unique<Batch<Task>>());
+                batch = batches.back().get();
+            }
+            auto *typed = static_cast<Batch<Task> *>(batch);
+            typed->tasks.push_back(std::move(task));
+            typed->positions.push_back(declared++);
+        }
+
+        /**
+         * @brief Runs a single Result method of Tester on a Tester of its own and takes the Result out
+         */
+        template<typename Test>
+        static std::vector<Result> RunOnTester(int group, Test test) {
+            Tester tester;
+            test(tester);
+            std::vector<Result> testResults = std::move(tester.results.front());
+            for(Result &result : testResults) {
+                result.groupNum = group;
+            }
+            return testResults;
+        }
+
+    public:
+        TestPlan() = default;
+        ~TestPlan() = default;
+
+        /**
+         * @brief Registers a Tester::testOne
+         */
+        template<typename T1, typename U2>
+        void testOne(T1 actual, U2 expected, std::string message = "") {
+            Register([=](int group) { return RunOnTester(group, [&](Tester &tester) { tester.testOne(actual, expected, message); }); });
+        }
+
+        /**
+         * @brief Registers a Tester::testFloat with a range
+         */
+        template<typename T1, typename U2>
+        void testFloat(T1 actual, U2 expected, double range, std::string message = "") {
+            Register([=](int group) { return std::vector<Result>{TestFloat(actual, expected, range, message, group).Run()}; });
+        }
+
+        /**
+         * @brief Registers a Tester::testFloat with a lower and upper bound
+         */
+        template<typename T1, typename U2>
+        void testFloat(T1 actual, U2 expected, double lowerBound, double upperBound, std::string message = "") {
+            Register([=](int group) { return std::vector<Result>{TestFloat(actual, expected, lowerBound, upperBound, message, group).Run()}; });
+        }
+
+        /**
+         * @brief Registers a Tester::testType
+         */
+        template<typename T1, typename U2>
+        void testType(std::vector<T1> actual, std::vector<U2> expected, std::string message = "", std::vector<std::string> messages = {}) {
+            Register([=](int group) { return TestType(actual, expected, message, messages, group).RunAll(); });
+        }
+
+        /**
+         * @brief Registers a Tester::testRange
+         */
+        template<typename T1, typename Callable, typename... Args>
+        void testRange(int from, int to, std::vector<T1> expected, std::string message, std::vector<std::string> messages, Callable &method, Args... args) {
+            Register([=, &method](int group) { return TestRange<T1>(from, to, expected, message, messages, group).RunAll(method, args...); });
+        }
+        template<typename Callable, typename... Args>
+        void testRange(int from, int to, Callable &method, Args... args) {
+            testRange(from, to, std::vector<int>{}, "", {}, method, args...);
+        }
+        template<typename T1, typename Callable, typename... Args>
+        void testRange(int from, int to, std::vector<T1> expected, Callable &method, Args... args) {
+            testRange(from, to, expected, "", {}, method, args...);
+        }
+
+        /**
+         * @brief Registers a Tester::testTwoVectorMethod
+         */
+        template<typename T1, typename U2, typename Callable, typename... Args>
+        void testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, std::string message, std::vector<std::string> messages, Callable &method, Args... args) {
+            Register([=, &method](int group) { return TestTwoVector<T1, U2>(inputs, expected, message, messages, group).RunAll(method, args...); });
+        }
+        template<typename T1, typename U2, typename Callable, typename... Args>
+        void testTwoVectorMethod(std::vector<T1> inputs, std::vector<U2> expected, Callable &method, Args... args) {
+            testTwoVectorMethod(inputs, expected, "", {}, method, args...);
+        }
+        template<typename T1, typename Callable, typename... Args>
+        void testTwoVectorMethod(std::vector<T1> inputs, Callable &method, Args... args) {
+            testTwoVectorMethod(inputs, std::vector<T1>{}, "", {}, method, args...);
+        }
+
+        /**
+         * @brief Registers a Tester::testException
+         */
+        template<typename Callable, typename... Args>
+        void testException(const std::string &exception, const std::string &message, Callable &method, Args... args) {
+            Register([=, &method](int group) { return RunOnTester(group, [&](Tester &tester) { tester.testException(exception, message, method, args...); }); });
+        }
+
+        /**
+         * @brief Registers any test, for tests Tester has no method for
+         * @param task Runs the test, task(int group) -> std::vector<Result>, group is the group number to use
+         */
+        template<typename Task>
+        void add(Task task) {
+            Register(std::move(task));
+        }
+
+        /**
+         * @brief The number of tests in the plan
+         */
+        std::size_t size() const {
+            return declared;
+        }
+
+        /**
+         * @brief Removes every test from the plan
+         */
+        void clear() {
+            batches.clear();
+            batchOfType.clear();
+            declared = 0;
+        }
+
+        /**
+         * @brief Runs every test of the plan and adds the Results to a Tester in declaration order
+         * @param tester The Tester that receives the results
+         * @param threads The number of threads, 0 for std::thread::hardware_concurrency
+         *
+         * The plan is kept, so it can be run again.
+         */
+        void run(Tester &tester, unsigned int threads = 0) {
+            std::vector<std::vector<Result>> slots(declared);
+            int firstGroup = static_cast<int>(tester.results.size() + 1);
+            for(std::unique_ptr<BatchBase> &batch : batches) {
+                BatchBase *current = batch.get();
+                parallelFor(current->Size(), threads, 0, [&](std::size_t begin, std::size_t end) {
+                    current->Run(begin, end, firstGroup, slots);
+                });
+            }
+            tester.results.reserve(tester.results.size() + slots.size());
+            for(std::vector<Result> &slot : slots) {
+                tester.results.push_back(std::move(slot));
+            }
+        }
     };
 
 }
 
+#if defined(TESTER_TRACK_ALLOCATIONS)
+// The replaced global allocation functions of TesterLib::AllocationTracker. Every block starts with a header that
+// holds its size, as large as the alignment of the block so the memory after it stays aligned.
+namespace TesterLib::Detail {
+    inline void *trackedAllocate(std::size_t size, std::size_t alignment, bool nothrow) {
+        alignment = std::max(alignment, static_cast<std::size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+        void *block = nullptr;
+        if(AllocationTracker::Allocate(size)) {
+            std::size_t total = (size + alignment + alignment - 1) / alignment * alignment;
+            block = alignment <= __STDCPP_DEFAULT_NEW_ALIGNMENT__ ? std::malloc(total) : std::aligned_alloc(alignment, total);
+            if(block == nullptr) {
+                AllocationTracker::Deallocate(size);
+            }
+        }
+        if(block == nullptr) {
+            if(nothrow) {
+                return nullptr;
+            }
+            throw std::bad_alloc();
+        }
+        auto *memory = static_cast<unsigned char *>(block) + alignment;
+        std::memcpy(memory - sizeof(std::size_t), &size, sizeof(std::size_t));
+        return memory;
+    }
+
+    inline void trackedDeallocate(void *pointer, std::size_t alignment) noexcept {
+        if(pointer == nullptr) {
+            return;
+        }
+        alignment = std::max(alignment, static_cast<std::size_t>(__STDCPP_DEFAULT_NEW_ALIGNMENT__));
+        auto *memory = static_cast<unsigned char *>(pointer);
+        std::size_t size = 0;
+        std::memcpy(&size, memory - sizeof(std::size_t), sizeof(std::size_t));
+        AllocationTracker::Deallocate(size);
+        std::free(memory - alignment);
+    }
+
+    static const bool trackerInstalled = (AllocationTracker::installed = true);
+}
 
+void *operator new(std::size_t size) { return TesterLib::Detail::trackedAllocate(size, 0, false); }
+void *operator new[](std::size_t size) { return TesterLib::Detail::trackedAllocate(size, 0, false); }
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept { return TesterLib::Detail::trackedAllocate(size, 0, true); }
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept { return TesterLib::Detail::trackedAllocate(size, 0, true); }
+void *operator new(std::size_t size, std::align_val_t alignment) { return TesterLib::Detail::trackedAllocate(size, static_cast<std::size_t>(alignment), false); }
+void *operator new[](std::size_t size, std::align_val_t alignment) { return TesterLib::Detail::trackedAllocate(size, static_cast<std::size_t>(alignment), false); }
+void *operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return TesterLib::Detail::trackedAllocate(size, static_cast<std::size_t>(alignment), true); }
+void *operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t &) noexcept { return TesterLib::Detail::trackedAllocate(size, static_cast<std::size_t>(alignment), true); }
+void operator delete(void *pointer) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete[](void *pointer) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete(void *pointer, std::size_t) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete[](void *pointer, std::size_t) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete(void *pointer, const std::nothrow_t &) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept { TesterLib::Detail::trackedDeallocate(pointer, 0); }
+void operator delete(void *pointer, std::align_val_t alignment) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void *pointer, std::align_val_t alignment) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete(void *pointer, std::size_t, std::align_val_t alignment) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void *pointer, std::size_t, std::align_val_t alignment) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete(void *pointer, std::align_val_t alignment, const std::nothrow_t &) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+void operator delete[](void *pointer, std::align_val_t alignment, const std::nothrow_t &) noexcept { TesterLib::Detail::trackedDeallocate(pointer, static_cast<std::size_t>(alignment)); }
+#endif
@@ -0,0 +1,237 @@
+#include "tester.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace TesterLib;
+
+namespace {
+    int square(int i) {
+        return i * i;
+    }
+
+    int pushBack(std::vector<int> &fixture, int i) {
+        fixture.push_back(i);
+        return static_cast<int>(fixture.size());
+    }
+
+    int lookup(std::vector<int> &fixture, int i) {
+        return fixture[static_cast<std::size_t>(i)];
+    }
+
+    std::size_t failedIn(const Tester &tester) {
+        std::size_t failed = 0;
+        for(const std::vector<Result> &group : tester.getResults()) {
+            for(const Result &result : group) {
+                failed += result.state ? 0 : 1;
+            }
+        }
+        return failed;
+    }
+
+    std::size_t countIn(const Tester &tester) {
+        std::size_t count = 0;
+        for(const std::vector<Result> &group : tester.getResults()) {
+            count += group.size();
+        }
+        return count;
+    }
+
+    std::vector<int> squaresUpTo(int last) {
+        std::vector<int> squares;
+        for(int i = 0; i <= last; i++) {
+            squares.push_back(i * i);
+        }
+        return squares;
+    }
+
+    std::string temporary(const std::string &name) {
+        return (std::filesystem::temp_directory_path() / ("tester-api-" + name)).string();
+    }
+
+    /**
+     * @brief Groups with dependencies, shared resources and a throwing group, on more threads than groups
+     */
+    void checkScheduler(Tester &checks) {
+        Tester tester;
+        tester.setThreads(2);
+        TestScheduler scheduler;
+        scheduler.Add("setup", [](Tester &t) { t.testOne(1, 1); }, {.cost = 5});
+        scheduler.Add("range", [](Tester &t) { t.testRange(0, 999, squaresUpTo(999), square); }, {.dependsOn = {"setup"}, .threads = 2});
+        scheduler.Add("first user", [](Tester &t) { t.testOne(2, 2); }, {.exclusive = {"port"}});
+        scheduler.Add("second user", [](Tester &t) { t.testOne(3, 3); }, {.exclusive = {"port"}});
+        scheduler.Add("throws", [](Tester &) { throw std::runtime_error("broken"); });
+        scheduler.Add("skipped", [](Tester &t) { t.testOne(4, 4); }, {.dependsOn = {"throws"}});
+        scheduler.Run(tester, 4);
+        checks.testOne(tester.getResults().size(), std::size_t{6}, "scheduler: one group per added group");
+        checks.testOne(tester.getResults()[1].size(), std::size_t{1000}, "scheduler: the range group keeps every result");
+        checks.testOne(failedIn(tester), std::size_t{2}, "scheduler: the throwing group and its dependent fail");
+
+        TestScheduler cyclic;
+        cyclic.Add("a", [](Tester &) {}, {.dependsOn = {"b"}});
+        cyclic.Add("b", [](Tester &) {}, {.dependsOn = {"a"}});
+        auto runCyclic = [&]() { cyclic.Run(tester); };
+        checks.testException("TestScheduler: the group dependencies have a cycle", "scheduler: dependency cycles are rejected", runCyclic);
+    }
+
+    /**
+     * @brief Tests of several types declared in a plan and run on several threads
+     */
+    void checkPlan(Tester &checks) {
+        std::vector<int> squares = squaresUpTo(499);
+        TestPlan plan;
+        for(int i = 0; i < 8; i++) {
+            plan.testRange(0, 499, squares, square);
+            plan.testOne(i, i);
+        }
+        plan.add([](int group) { return std::vector<Result>{Result(" Passed: custom", true, group, 1)}; });
+        Tester tester;
+        plan.run(tester, 4);
+        checks.testOne(tester.getResults().size(), std::size_t{17}, "plan: one group per declared test");
+        checks.testOne(countIn(tester), std::size_t{8 * 500 + 8 + 1}, "plan: every result is kept");
+        checks.testOne(failedIn(tester), std::size_t{0}, "plan: every test passes");
+        checks.testOne(tester.getResults()[2].front().groupNum, 3, "plan: groups are numbered in declaration order");
+    }
+
+    /**
+     * @brief A shared fixture, built once per thread and reset between tests
+     */
+    void checkFixture(Tester &checks) {
+        Fixture<std::vector<int>> fixture([] { return std::vector<int>{0, 1, 4, 9}; }, [](std::vector<int> &v) { v.resize(4); });
+        auto bound = fixture.Bind(lookup);
+        Tester tester;
+        tester.testRange(0, 3, std::vector<int>{0, 1, 4, 9}, bound);
+        tester.testRange(0, 3, std::vector<int>{0, 1, 4, 9}, bound);
+        checks.testOne(failedIn(tester), std::size_t{0}, "fixture: every lookup passes");
+        checks.testOne(fixture.Setups(), 1ull, "fixture: setup runs once");
+    }
+
+    /**
+     * @brief Every batch starts from the fixture as it was built, even though the tests change it
+     */
+    void checkForkFixture(Tester &checks) {
+        ForkFixture<std::vector<int>> fixture([] { return std::vector<int>{}; }, 2);
+        Tester tester;
+        std::vector<Result> forked = tester.testRangeForked(0, 11, std::vector<int>{1, 2, 3, 1, 2, 3, 1, 2, 3, 1, 2, 3}, fixture, 3, pushBack);
+        checks.testOne(forked.size(), std::size_t{12}, "fork fixture: every test reports back");
+        checks.testOne(failedIn(tester), std::size_t{0}, "fork fixture: every batch starts from a pristine fixture");
+        checks.testOne(fixture.Get().size(), std::size_t{0}, "fork fixture: the parent's fixture is untouched");
+    }
+
+    /**
+     * @brief A finished sweep is restored from its checkpoint instead of running again
+     */
+    void checkCheckpoint(Tester &checks) {
+        std::string path = temporary("checkpoint");
+        std::vector<int> squares = squaresUpTo(1000);
+        squares.erase(squares.begin());
+        {
+            Checkpoint checkpoint(path, 100);
+            Tester tester;
+            tester.testRangeCheckpointed(1, 1000, squares, checkpoint, square);
+            checks.testOne(checkpoint.Resumed(), false, "checkpoint: a new sweep is not resumed");
+        }
+        Checkpoint checkpoint(path, 100);
+        Tester tester;
+        std::vector<Result> resumed = tester.testRangeCheckpointed(1, 1000, squares, checkpoint, square);
+        checks.testOne(checkpoint.Resumed(), true, "checkpoint: the second sweep resumes");
+        checks.testOne(resumed.size(), std::size_t{1000}, "checkpoint: every test is restored");
+        checks.testOne(resumed.back().message.find("(resumed)") != std::string::npos, true, "checkpoint: restored tests are marked");
+        checkpoint.Remove();
+        checks.testOne(std::filesystem::exists(path), false, "checkpoint: Remove deletes the file");
+    }
+
+    /**
+     * @brief Merged groups are renumbered and keep their own tags, saved results merge back the same
+     */
+    void checkMerge(Tester &checks) {
+        Tester tester;
+        tester.setTag("mine");
+        tester.testOne(1, 1);
+        Tester other;
+        other.testOne(2, 2);
+        other.setTag("theirs");
+        other.testOne(3, 4);
+        tester.merge(std::move(other));
+        tester.testOne(5, 5);
+        checks.testOne(tester.getResults().size(), std::size_t{4}, "merge: groups are appended");
+        checks.testOne(tester.getResults()[2].front().groupNum, 3, "merge: merged groups are renumbered");
+        checks.testOne(tester.tagOf(2), std::string(""), "merge: untagged merged groups stay untagged");
+        checks.testOne(tester.tagOf(3), std::string("theirs"), "merge: merged groups keep their tags");
+        checks.testOne(tester.tagOf(4), std::string("mine"), "merge: the current tag applies again afterwards");
+        checks.testOne(other.getResults().empty(), true, "merge: other is left empty");
+
+        std::string path = temporary("results.tlrs");
+        checks.testOne(tester.saveResults(path), true, "saveResults: the file is written");
+        Tester loaded;
+        loaded.testOne(0, 0);
+        checks.testOne(loaded.mergeFile(path), true, "mergeFile: the file is read");
+        checks.testOne(loaded.getResults().size(), std::size_t{5}, "mergeFile: groups are appended");
+        checks.testOne(loaded.getResults()[3].front().message, tester.getResults()[2].front().message, "mergeFile: results round trip");
+        checks.testOne(loaded.getResults()[3].front().groupNum, 4, "mergeFile: groups are renumbered");
+        std::remove(path.c_str());
+    }
+
+    /**
+     * @brief A child that crashes leaves its results behind, and they can be merged
+     */
+    void checkCrashHandler(Tester &checks) {
+#if defined(__unix__) || defined(__APPLE__)
+        std::string path = temporary("crash.tlrs");
+        std::fflush(nullptr);
+        pid_t child = ::fork();
+        if(child == 0) {
+            Tester tester;
+            tester.testOne(1, 1);
+            tester.testOne(2, 3);
+            if(!tester.installCrashHandler(path)) {
+                ::_exit(2);
+            }
+            std::raise(SIGSEGV);
+            ::_exit(3);
+        }
+        int status = 0;
+        ::waitpid(child, &status, 0);
+        checks.testOne(WIFSIGNALED(status) && WTERMSIG(status) == SIGSEGV, true, "crash handler: the signal still ends the process");
+        Tester tester;
+        checks.testOne(tester.mergeFile(path), true, "crash handler: the results are written");
+        checks.testOne(countIn(tester), std::size_t{2}, "crash handler: every recorded result is kept");
+        checks.testOne(failedIn(tester), std::size_t{1}, "crash handler: failures are kept");
+        std::remove(path.c_str());
+#else
+        (void) checks;
+#endif
+    }
+}
+
+/**
+ * Runs every check, or with --concurrency only the ones that run tests on several threads, for the
+ * -fsanitize=thread build. Exits with 1 if a check failed.
+ */
+int main(int argc, char **argv) {
+    bool concurrencyOnly = argc > 1 && std::strcmp(argv[1], "--concurrency") == 0;
+    Tester checks;
+    checkScheduler(checks);
+    checkPlan(checks);
+    if(!concurrencyOnly) {
+        checkFixture(checks);
+        checkForkFixture(checks);
+        checkCheckpoint(checks);
+        checkMerge(checks);
+        checkCrashHandler(checks);
+    }
+    checks.printResults(false);
+    std::size_t failed = failedIn(checks);
+    std::cout << countIn(checks) - failed << "/" << countIn(checks) << " checks passed" << std::endl;
+    return failed == 0 ? 0 : 1;
+}